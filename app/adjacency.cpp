@@ -0,0 +1,344 @@
+/**
+ * @file adjacency.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the Adjacency kernels (scalar, bit-sliced and AVX2) and the runtime
+ *        dispatch between them.
+ */
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <vector>
+#include "adjacency.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define QT_MINESWEEPER_HAVE_AVX2_KERNEL
+#include <immintrin.h>
+#endif
+
+namespace {
+
+constexpr std::uint8_t COUNT_MASK = 0x0F; // The count lives in the low nibble of a cell byte
+
+// SPREAD[b] has byte i set to bit i of b, turning 8 bits of a plane into 8 cell bytes
+constexpr std::array<std::uint64_t, 256> SPREAD = [] {
+    std::array<std::uint64_t, 256> table{};
+    for (int bits = 0; bits < 256; bits++) {
+        for (int i = 0; i < 8; i++) {
+            table[bits] |= static_cast<std::uint64_t>((bits >> i) & 1) << (8 * i);
+        }
+    }
+    return table;
+}();
+
+bool isMineBit(const std::uint64_t *row, int x) {
+    return (row[x >> 6] >> (x & 63)) & 1;
+}
+
+/**
+ * Adds the left, centre and right neighbour of every cell in a row of words. The 2-bit sums (0 to
+ * 3) are returned as two bit-planes.
+ */
+void horizontalSums(const std::uint64_t *row, int words, std::uint64_t *sum0, std::uint64_t *sum1) {
+    for (int k = 0; k < words; k++) {
+        std::uint64_t centre = row[k];
+        std::uint64_t previous = k > 0 ? row[k - 1] : 0;
+        std::uint64_t next = k + 1 < words ? row[k + 1] : 0;
+
+        std::uint64_t left = (centre << 1) | (previous >> 63); // Bit x holds cell x - 1
+        std::uint64_t right = (centre >> 1) | (next << 63); // Bit x holds cell x + 1
+
+        sum0[k] = left ^ centre ^ right;
+        sum1[k] = (left & centre) | (right & (left ^ centre));
+    }
+}
+
+/**
+ * Adds the row sums above, at and below a word into four count bit-planes (0 to 9) and clears the
+ * lanes that hold mines. The centre cell is part of the sum, but it only matters for mines, whose
+ * count is cleared anyway.
+ */
+void verticalSum(std::uint64_t a0, std::uint64_t a1, std::uint64_t b0, std::uint64_t b1, std::uint64_t c0,
+                 std::uint64_t c1, std::uint64_t mines, std::uint64_t planes[4]) {
+    // Weight 1: three bits
+    std::uint64_t ones = a0 ^ b0 ^ c0;
+    std::uint64_t carryTwos = (a0 & b0) | (c0 & (a0 ^ b0));
+
+    // Weight 2: three bits plus the carry
+    std::uint64_t twos = a1 ^ b1 ^ c1;
+    std::uint64_t carryFours = (a1 & b1) | (c1 & (a1 ^ b1));
+    std::uint64_t twosCarry = twos & carryTwos;
+    twos ^= carryTwos;
+
+    // Weight 4: two carries, whose own carry is the weight 8 bit
+    std::uint64_t fours = carryFours ^ twosCarry;
+    std::uint64_t eights = carryFours & twosCarry;
+
+    planes[0] = ones & ~mines;
+    planes[1] = twos & ~mines;
+    planes[2] = fours & ~mines;
+    planes[3] = eights & ~mines;
+}
+
+/**
+ * Writes the counts of up to 64 cells, held in four bit-planes, into the low nibbles of their cell
+ * bytes, 8 cells at a time.
+ */
+void spreadPlanes(const std::uint64_t planes[4], int count, std::uint8_t *cells) {
+    for (int offset = 0; offset < count; offset += 8) {
+        std::uint64_t counts = SPREAD[(planes[0] >> offset) & 0xFF] |
+                               SPREAD[(planes[1] >> offset) & 0xFF] << 1 |
+                               SPREAD[(planes[2] >> offset) & 0xFF] << 2 |
+                               SPREAD[(planes[3] >> offset) & 0xFF] << 3;
+
+        if (std::endian::native == std::endian::little && count - offset >= 8) {
+            std::uint64_t bytes;
+            std::memcpy(&bytes, cells + offset, sizeof bytes);
+            bytes = (bytes & 0xF0F0F0F0F0F0F0F0ULL) | counts;
+            std::memcpy(cells + offset, &bytes, sizeof bytes);
+        } else {
+            for (int i = 0; i < 8 && offset + i < count; i++) {
+                std::uint8_t &cell = cells[offset + i];
+                cell = (cell & ~COUNT_MASK) | static_cast<std::uint8_t>((counts >> (8 * i)) & COUNT_MASK);
+            }
+        }
+    }
+}
+
+#ifdef QT_MINESWEEPER_HAVE_AVX2_KERNEL
+
+/**
+ * Turns 32 bits into 32 bytes that hold `value` where the bit is set and zero elsewhere.
+ */
+__attribute__((target("avx2")))
+__m256i expandBits(std::uint32_t bits, __m256i value) {
+    const __m256i select = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                            2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i bitMask = _mm256_set1_epi64x(static_cast<long long>(0x8040201008040201ULL));
+
+    __m256i bytes = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(bits)), select);
+    bytes = _mm256_cmpeq_epi8(_mm256_and_si256(bytes, bitMask), bitMask);
+    return _mm256_and_si256(bytes, value);
+}
+
+/**
+ * AVX2 version of spreadPlanes(), writing 32 cells per iteration.
+ */
+__attribute__((target("avx2")))
+void spreadPlanesAvx2(const std::uint64_t planes[4], int count, std::uint8_t *cells) {
+    const __m256i highNibbles = _mm256_set1_epi8(static_cast<char>(0xF0));
+    int offset = 0;
+
+    for (; offset + 32 <= count; offset += 32) {
+        __m256i counts = _mm256_or_si256(
+                _mm256_or_si256(expandBits(static_cast<std::uint32_t>(planes[0] >> offset), _mm256_set1_epi8(1)),
+                                expandBits(static_cast<std::uint32_t>(planes[1] >> offset), _mm256_set1_epi8(2))),
+                _mm256_or_si256(expandBits(static_cast<std::uint32_t>(planes[2] >> offset), _mm256_set1_epi8(4)),
+                                expandBits(static_cast<std::uint32_t>(planes[3] >> offset), _mm256_set1_epi8(8))));
+
+        auto *target = reinterpret_cast<__m256i *>(cells + offset);
+        __m256i bytes = _mm256_loadu_si256(target);
+        _mm256_storeu_si256(target, _mm256_or_si256(_mm256_and_si256(bytes, highNibbles), counts));
+    }
+
+    if (offset < count) {
+        std::uint64_t rest[4] = {planes[0] >> offset, planes[1] >> offset, planes[2] >> offset, planes[3] >> offset};
+        spreadPlanes(rest, count - offset, cells + offset);
+    }
+}
+
+#endif
+
+using SpreadFunction = void (*)(const std::uint64_t planes[4], int count, std::uint8_t *cells);
+
+/**
+ * Shared driver of the bit-sliced kernels. Keeps the row sums of the rows above, at and below the
+ * current row in a rolling window, so every mine word is read once. Rows outside [firstRow, endRow)
+ * are only read, so disjoint row ranges can be computed concurrently.
+ */
+void computeBitSliced(SpreadFunction spread, const std::uint64_t *mines, int wordsPerRow, int width, int height,
+                      int firstRow, int endRow, std::uint8_t *cells) {
+    // Row sums of rows y - 1, y and y + 1 (two planes each), plus a zero row for the borders
+    std::vector<std::uint64_t> sums(static_cast<std::size_t>(wordsPerRow) * 8, 0);
+    std::uint64_t *zero = sums.data() + 6 * wordsPerRow;
+    std::uint64_t *above = sums.data();
+    std::uint64_t *current = above + 2 * wordsPerRow;
+    std::uint64_t *below = current + 2 * wordsPerRow;
+
+    horizontalSums(mines + static_cast<std::size_t>(firstRow) * wordsPerRow, wordsPerRow, current,
+                   current + wordsPerRow);
+    std::uint64_t *previous = zero;
+    if (firstRow > 0) {
+        horizontalSums(mines + static_cast<std::size_t>(firstRow - 1) * wordsPerRow, wordsPerRow, above,
+                       above + wordsPerRow);
+        previous = above;
+    }
+
+    for (int y = firstRow; y < endRow; y++) {
+        std::uint64_t *next = zero;
+        if (y + 1 < height) {
+            horizontalSums(mines + static_cast<std::size_t>(y + 1) * wordsPerRow, wordsPerRow, below,
+                           below + wordsPerRow);
+            next = below;
+        }
+
+        const std::uint64_t *row = mines + static_cast<std::size_t>(y) * wordsPerRow;
+        std::uint8_t *rowCells = cells + static_cast<std::size_t>(y) * width;
+
+        for (int k = 0; k < wordsPerRow; k++) {
+            std::uint64_t planes[4];
+            verticalSum(previous[k], previous[wordsPerRow + k], current[k], current[wordsPerRow + k],
+                        next[k], next[wordsPerRow + k], row[k], planes);
+
+            int first = k * 64;
+            spread(planes, width - first < 64 ? width - first : 64, rowCells + first);
+        }
+
+        // Rotate the window: the current row becomes the one above, the one below becomes current
+        std::uint64_t *recycled = above;
+        above = current;
+        current = below;
+        below = recycled;
+        previous = above;
+    }
+}
+
+/**
+ * Reference kernel: counts the 3x3 neighbourhood of every cell one bit at a time.
+ */
+void computeScalar(const std::uint64_t *mines, int wordsPerRow, int width, int height, int firstRow, int endRow,
+                   std::uint8_t *cells) {
+    for (int y = firstRow; y < endRow; y++) {
+        const std::uint64_t *row = mines + static_cast<std::size_t>(y) * wordsPerRow;
+
+        for (int x = 0; x < width; x++) {
+            int mineCount = 0;
+
+            if (!isMineBit(row, x)) {
+                for (int ny = y - 1; ny <= y + 1; ny++) {
+                    if (ny < 0 || ny >= height) continue;
+                    const std::uint64_t *neighbourRow = mines + static_cast<std::size_t>(ny) * wordsPerRow;
+
+                    for (int nx = x - 1; nx <= x + 1; nx++) {
+                        if (nx >= 0 && nx < width && isMineBit(neighbourRow, nx)) {
+                            mineCount++;
+                        }
+                    }
+                }
+            }
+
+            std::uint8_t &cell = cells[static_cast<std::size_t>(y) * width + x];
+            cell = (cell & ~COUNT_MASK) | static_cast<std::uint8_t>(mineCount);
+        }
+    }
+}
+
+}
+
+/**
+ * @function getBestKernel
+ * @brief Returns the fastest kernel the running CPU supports.
+ *
+ * The CPU is only queried once; later calls return the cached answer.
+ *
+ * @return The kernel compute() dispatches to.
+ */
+Adjacency::Kernel Adjacency::getBestKernel() {
+    static const Kernel best = isSupported(Kernel::AVX2) ? Kernel::AVX2 : Kernel::BIT_SLICED;
+    return best;
+}
+
+/**
+ * @function isSupported
+ * @brief Checks whether a kernel can run on this CPU and build.
+ *
+ * @param kernel The kernel to check.
+ * @return True if the kernel can be used, false otherwise.
+ */
+bool Adjacency::isSupported(Kernel kernel) {
+    if (kernel != Kernel::AVX2) {
+        return true;
+    }
+
+#ifdef QT_MINESWEEPER_HAVE_AVX2_KERNEL
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+/**
+ * @function compute
+ * @brief Computes the adjacent mine count of every cell with the best available kernel.
+ *
+ * @param mines The mine bitmap. Bit x % 64 of word y * wordsPerRow + x / 64 is set for a mine at
+ *              (x, y); the unused bits at the end of each row must be zero.
+ * @param wordsPerRow The number of words per bitmap row, at least (width + 63) / 64.
+ * @param width The number of cells in a row.
+ * @param height The number of cells in a column.
+ * @param cells The row-major cell bytes. The low nibble of each byte receives the count (zero for
+ *              mines); the high nibble is left untouched.
+ */
+void Adjacency::compute(const std::uint64_t *mines, int wordsPerRow, int width, int height, std::uint8_t *cells) {
+    compute(getBestKernel(), mines, wordsPerRow, width, height, cells);
+}
+
+/**
+ * @function compute
+ * @brief Computes the adjacent mine count of every cell with a specific kernel.
+ *
+ * All kernels produce identical results. Asking for a kernel the CPU does not support falls back
+ * to the bit-sliced kernel.
+ *
+ * @param kernel The kernel to use.
+ * @param mines The mine bitmap, laid out as for the dispatching overload.
+ * @param wordsPerRow The number of words per bitmap row.
+ * @param width The number of cells in a row.
+ * @param height The number of cells in a column.
+ * @param cells The row-major cell bytes whose low nibbles receive the counts.
+ */
+void Adjacency::compute(Kernel kernel, const std::uint64_t *mines, int wordsPerRow, int width, int height,
+                        std::uint8_t *cells) {
+    computeRows(kernel, mines, wordsPerRow, width, height, 0, height, cells);
+}
+
+/**
+ * @function computeRows
+ * @brief Computes the adjacent mine counts of a band of rows.
+ *
+ * The mine rows directly above and below the band are read but only the cells of the band are
+ * written, so disjoint bands of the same board can be computed on different threads.
+ *
+ * @param kernel The kernel to use.
+ * @param mines The mine bitmap of the whole board, laid out as for compute().
+ * @param wordsPerRow The number of words per bitmap row.
+ * @param width The number of cells in a row.
+ * @param height The number of cells in a column of the whole board.
+ * @param firstRow The first row of the band.
+ * @param endRow One past the last row of the band.
+ * @param cells The row-major cell bytes of the whole board.
+ */
+void Adjacency::computeRows(Kernel kernel, const std::uint64_t *mines, int wordsPerRow, int width, int height,
+                            int firstRow, int endRow, std::uint8_t *cells) {
+    if (width <= 0 || firstRow < 0 || endRow > height || firstRow >= endRow) {
+        return;
+    }
+
+    switch (kernel) {
+        case Kernel::SCALAR:
+            computeScalar(mines, wordsPerRow, width, height, firstRow, endRow, cells);
+            break;
+#ifdef QT_MINESWEEPER_HAVE_AVX2_KERNEL
+        case Kernel::AVX2:
+            if (isSupported(Kernel::AVX2)) {
+                computeBitSliced(spreadPlanesAvx2, mines, wordsPerRow, width, height, firstRow, endRow, cells);
+                break;
+            }
+            [[fallthrough]];
+#endif
+        default:
+            computeBitSliced(spreadPlanes, mines, wordsPerRow, width, height, firstRow, endRow, cells);
+            break;
+    }
+}
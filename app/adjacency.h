@@ -0,0 +1,42 @@
+/**
+ * @file adjacency.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the Adjacency class that computes the adjacent mine count of every cell at once.
+ *
+ * The counts are computed from a packed mine bitmap, one bit per cell and one 64-bit word per 64
+ * cells of a row. The bit-sliced kernel treats each word as 64 parallel lanes: it adds the left,
+ * centre and right neighbours of a row with bitwise full adders, then adds three such row sums into
+ * four bit-planes holding counts from 0 to 9, and finally spreads the planes out into one byte per
+ * cell. The AVX2 kernel does the same arithmetic but spreads 32 cells per instruction, and a plain
+ * scalar kernel is kept as the reference. compute() picks the fastest kernel the CPU supports.
+ */
+
+#ifndef QT_MINESWEEPER_ADJACENCY_H
+#define QT_MINESWEEPER_ADJACENCY_H
+
+#include <cstdint>
+
+class Adjacency {
+public:
+
+    enum class Kernel {
+        SCALAR,
+        BIT_SLICED,
+        AVX2
+    };
+
+    static Kernel getBestKernel();
+
+    static bool isSupported(Kernel kernel);
+
+    static void compute(const std::uint64_t *mines, int wordsPerRow, int width, int height, std::uint8_t *cells);
+
+    static void compute(Kernel kernel, const std::uint64_t *mines, int wordsPerRow, int width, int height,
+                        std::uint8_t *cells);
+
+    static void computeRows(Kernel kernel, const std::uint64_t *mines, int wordsPerRow, int width, int height,
+                            int firstRow, int endRow, std::uint8_t *cells);
+};
+
+#endif //QT_MINESWEEPER_ADJACENCY_H
@@ -0,0 +1,726 @@
+/**
+ * @file board.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the Board class, which stores the packed cell state of a game and
+ *        applies the reveal and mark rules to it.
+ */
+
+#include <algorithm>
+#include "adjacency.h"
+#include "board.h"
+#include "boardconfig.h"
+#include "gridgeometry.h"
+#include "random.h"
+#include "trace.h"
+
+/**
+ * @function Board
+ * @brief Constructs an empty board.
+ *
+ * All cells start hidden, unmarked and without mines. Mines are placed with setMine() and the
+ * adjacent counts are filled in by calculateAdjacentMines().
+ *
+ * @param width The number of cells in a row.
+ * @param height The number of cells in a column.
+ * @param mineCount The number of mines that will be placed on the board.
+ * @param topology Which cells are neighbours.
+ */
+Board::Board(int width, int height, int mineCount, Topology::Kind topology)
+        : width(width), height(height), mineCount(mineCount), topology(topology),
+          neighbourTable(topology == Topology::Kind::RECTANGLE ? nullptr : Topology::get(topology, width, height)),
+          wordsPerRow((width + 63) / 64), seed(0),
+          revealedSafeCells(0), explodedIndex(-1), openingPending(true), allRevealed(false),
+          cells(static_cast<std::size_t>(width) * height, 0),
+          minePlane(static_cast<std::size_t>(wordsPerRow) * height, 0) {}
+
+/**
+ * @function reset
+ * @brief Resets the board to its initial state.
+ *
+ * Clears every cell, including mines and adjacent counts, as if the board was just constructed.
+ * The player state and the layout share the cell bytes, and clearing the layout mine by mine is
+ * slower than a fill at any realistic density, so the whole array is filled.
+ */
+void Board::reset() {
+    std::fill(cells.begin(), cells.end(), 0);
+    std::fill(minePlane.begin(), minePlane.end(), 0);
+    touchedCells.clear();
+    seed = 0;
+    revealedSafeCells = 0;
+    explodedIndex = -1;
+    openingPending = true;
+    allRevealed = false;
+}
+
+/**
+ * @function getWidth
+ * @brief Returns the number of cells in a row.
+ *
+ * @return The board width.
+ */
+int Board::getWidth() const {
+    return width;
+}
+
+/**
+ * @function getHeight
+ * @brief Returns the number of cells in a column.
+ *
+ * @return The board height.
+ */
+int Board::getHeight() const {
+    return height;
+}
+
+/**
+ * @function getMineCount
+ * @brief Returns the number of mines on the board.
+ *
+ * @return The number of mines.
+ */
+int Board::getMineCount() const {
+    return mineCount;
+}
+
+/**
+ * @function getTopology
+ * @brief Returns which cells of the board are neighbours.
+ *
+ * @return The topology of the board.
+ */
+Topology::Kind Board::getTopology() const {
+    return topology;
+}
+
+/**
+ * @function getSeed
+ * @brief Returns the seed the mine layout was generated from.
+ *
+ * @return The seed of the board, or zero if the mines were placed by hand.
+ */
+std::uint64_t Board::getSeed() const {
+    return seed;
+}
+
+/**
+ * @function setSeed
+ * @brief Records the seed the mine layout was generated from.
+ *
+ * @param seed The seed of the board.
+ */
+void Board::setSeed(std::uint64_t seed) {
+    Board::seed = seed;
+}
+
+/**
+ * @function contains
+ * @brief Checks whether a coordinate lies on the board.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return True if the cell is within the board bounds, false otherwise.
+ */
+bool Board::contains(int x, int y) const {
+    return x >= 0 && x < width && y >= 0 && y < height;
+}
+
+/**
+ * @function isMine
+ * @brief Returns true if the cell is a mine.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return True if the cell is a mine, false otherwise.
+ */
+bool Board::isMine(int x, int y) const {
+    return cells[index(x, y)] & MINE_BIT;
+}
+
+/**
+ * @function setMine
+ * @brief Sets or clears the mine bit of a cell.
+ *
+ * Adjacent counts are not updated; call calculateAdjacentMines() once all mines are placed.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @param mine Boolean flag indicating if the cell is a mine.
+ */
+void Board::setMine(int x, int y, bool mine) {
+    std::uint8_t &cell = cells[index(x, y)];
+    std::uint64_t &word = minePlane[static_cast<std::size_t>(y) * wordsPerRow + x / 64];
+    std::uint64_t bit = std::uint64_t{1} << (x % 64);
+
+    if (mine) {
+        cell |= MINE_BIT;
+        word |= bit;
+    } else {
+        cell &= ~MINE_BIT;
+        word &= ~bit;
+    }
+}
+
+/**
+ * @function getAdjacentMines
+ * @brief Returns the number of mines adjacent to the cell.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The number of adjacent mines, in [0, 8].
+ */
+int Board::getAdjacentMines(int x, int y) const {
+    return cells[index(x, y)] & ADJACENT_MASK;
+}
+
+/**
+ * @function isRevealed
+ * @brief Returns true if the cell is revealed.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return True if the cell is revealed, false otherwise.
+ */
+bool Board::isRevealed(int x, int y) const {
+    return allRevealed || cells[index(x, y)] & REVEALED_BIT;
+}
+
+/**
+ * @function isExploded
+ * @brief Returns true if the cell is the mine that ended the game.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return True if the player stepped on this cell's mine, false otherwise.
+ */
+bool Board::isExploded(int x, int y) const {
+    return explodedIndex == index(x, y);
+}
+
+/**
+ * @function getMark
+ * @brief Returns the mark the player has put on the cell.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The mark of the cell.
+ */
+Board::Mark Board::getMark(int x, int y) const {
+    return static_cast<Mark>(cells[index(x, y)] >> MARK_SHIFT);
+}
+
+/**
+ * @function getMinePlane
+ * @brief Returns the mine bit-plane.
+ *
+ * Bit x % 64 of word y * getWordsPerRow() + x / 64 is set if (x, y) is a mine. The unused bits at
+ * the end of each row are always zero.
+ *
+ * @return A pointer to the first word of the bit-plane.
+ */
+const std::uint64_t *Board::getMinePlane() const {
+    return minePlane.data();
+}
+
+/**
+ * @function getWordsPerRow
+ * @brief Returns the number of 64-bit words in each row of the mine bit-plane.
+ *
+ * @return The row stride of the mine bit-plane.
+ */
+int Board::getWordsPerRow() const {
+    return wordsPerRow;
+}
+
+/**
+ * @function calculateAdjacentMines
+ * @brief Calculates the number of adjacent mines for each cell.
+ *
+ * On a rectangle, all counts are computed in one pass over the mine bit-plane by the fastest
+ * Adjacency kernel the CPU supports; other topologies count the mines through the neighbour table.
+ * Mines keep an adjacent count of zero.
+ */
+void Board::calculateAdjacentMines() {
+    if (topology != Topology::Kind::RECTANGLE) {
+        calculateAdjacentMines(0, height);
+        return;
+    }
+    Adjacency::compute(minePlane.data(), wordsPerRow, width, height, cells.data());
+}
+
+/**
+ * @function calculateAdjacentMines
+ * @brief Calculates the number of adjacent mines for a band of rows.
+ *
+ * Only the cells of the band are written, so disjoint bands can be calculated concurrently.
+ *
+ * @param firstRow The first row of the band.
+ * @param endRow One past the last row of the band.
+ */
+void Board::calculateAdjacentMines(int firstRow, int endRow) {
+    if (neighbourTable) {
+        for (int cell = firstRow * width; cell < endRow * width; cell++) {
+            int count = 0;
+            if (!(cells[cell] & MINE_BIT)) {
+                neighbourTable->forEachNeighbour(cell, [&](int neighbour) {
+                    count += (cells[neighbour] & MINE_BIT) != 0;
+                });
+            }
+            cells[cell] = (cells[cell] & ~ADJACENT_MASK) | count;
+        }
+        return;
+    }
+    Adjacency::computeRows(Adjacency::getBestKernel(), minePlane.data(), wordsPerRow, width, height, firstRow,
+                           endRow, cells.data());
+}
+
+/**
+ * @function reveal
+ * @brief Reveals a cell and floods the opening around it.
+ *
+ * Revealing a cell clears any mark on it. If the cell is a mine, the game is lost and the cell is
+ * remembered as the exploded mine. If the cell has no adjacent mines, its whole opening is revealed
+ * in one pass by floodFill().
+ *
+ * Unless disabled with setOpeningPending(), the first reveal of a game can never hit a mine: before
+ * it is applied, clearOpening() moves the mines out of the clicked cell's neighbourhood.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @param revealedCells Optional list the indices of all newly revealed cells are appended to.
+ * @return Whether the cell was safe, a mine, or ignored because it was already revealed.
+ */
+Board::RevealResult Board::reveal(int x, int y, std::vector<int> *revealedCells) {
+    TRACE_SCOPE("Board::reveal");
+    int start = index(x, y);
+
+    if (cells[start] & REVEALED_BIT || allRevealed || isLost()) {
+        return RevealResult::IGNORED;
+    }
+
+    if (openingPending) {
+        clearOpening(x, y);
+    }
+
+    if (!revealCell(start, revealedCells)) {
+        explodedIndex = start;
+        return RevealResult::MINE;
+    }
+
+    if ((cells[start] & ADJACENT_MASK) == 0) {
+        withGeometry([&](const auto &geometry) {
+            floodFill(geometry, start, revealedCells);
+        });
+    }
+
+    return RevealResult::SAFE;
+}
+
+/**
+ * @function clearOpening
+ * @brief Moves the mines out of the 3x3 neighbourhood of the first revealed cell.
+ *
+ * Each mine in the neighbourhood is moved to a random safe cell outside of it, so the first reveal
+ * always opens an area. If the board is too dense for that, only the clicked cell is cleared. The
+ * destinations are drawn from a Random derived from the board seed and the clicked cell, so a
+ * replayed game relocates the same mines to the same places. Every move only updates the adjacent
+ * counts around the old and the new position.
+ *
+ * @param x The x-coordinate of the first revealed cell.
+ * @param y The y-coordinate of the first revealed cell.
+ */
+void Board::clearOpening(int x, int y) {
+    openingPending = false;
+
+    int start = index(x, y);
+    int cellCount = width * height;
+    std::vector<int> zone(1, start);
+    withGeometry([&](const auto &geometry) {
+        geometry.forEachNeighbour(start, [&](int neighbour) {
+            zone.push_back(neighbour);
+        });
+    });
+
+    // Row-major order, so the mines are moved in the same order on every topology
+    std::sort(zone.begin(), zone.end());
+    std::vector<int> zoneMines;
+    for (int cell: zone) {
+        if (cells[cell] & MINE_BIT) {
+            zoneMines.push_back(cell);
+        }
+    }
+
+    if (zoneMines.empty()) {
+        return;
+    }
+
+    auto zoneCells = static_cast<int>(zone.size());
+    auto zoneMineCount = static_cast<int>(zoneMines.size());
+    int safeOutside = (cellCount - mineCount) - (zoneCells - zoneMineCount);
+    bool wholeZone = safeOutside >= zoneMineCount;
+
+    if (!wholeZone) {
+        // Too dense to clear the neighbourhood, so only keep the clicked cell safe
+        if (!(cells[start] & MINE_BIT) || mineCount == cellCount) {
+            return;
+        }
+        zoneMines.assign(1, start);
+        safeOutside = cellCount - mineCount;
+    }
+
+    auto isAllowed = [&](int cell) {
+        if (cells[cell] & MINE_BIT) return false;
+        if (!wholeZone) return cell != start;
+        return !std::binary_search(zone.begin(), zone.end(), cell);
+    };
+
+    Random random(Random::mix(seed) + static_cast<std::uint64_t>(start));
+
+    // On nearly full boards rejection sampling would take many draws per mine, so list the candidates instead
+    std::vector<int> candidates;
+    if (static_cast<long long>(safeOutside) * 64 < cellCount) {
+        for (int cell = 0; cell < cellCount; cell++) {
+            if (isAllowed(cell)) {
+                candidates.push_back(cell);
+            }
+        }
+    }
+
+    for (int from: zoneMines) {
+        int to;
+        if (candidates.empty()) {
+            do {
+                to = static_cast<int>(random.nextBelow(cellCount));
+            } while (!isAllowed(to));
+        } else {
+            auto pick = static_cast<std::size_t>(random.nextBelow(candidates.size()));
+            to = candidates[pick];
+            candidates[pick] = candidates.back();
+            candidates.pop_back();
+        }
+
+        moveMine(from % width, from / width, to % width, to / width);
+    }
+}
+
+/**
+ * @function moveMine
+ * @brief Moves a mine to a cell without a mine and updates the affected adjacent counts.
+ *
+ * Only the 3x3 neighbourhoods of the two cells are touched: the neighbours of the old position
+ * lose one adjacent mine, the old position gets its own count, and the neighbours of the new
+ * position gain one adjacent mine.
+ *
+ * @param fromX The x-coordinate of the mine.
+ * @param fromY The y-coordinate of the mine.
+ * @param toX The x-coordinate of the cell the mine moves to.
+ * @param toY The y-coordinate of the cell the mine moves to.
+ */
+void Board::moveMine(int fromX, int fromY, int toX, int toY) {
+    if (!isMine(fromX, fromY) || isMine(toX, toY)) {
+        return;
+    }
+
+    int from = index(fromX, fromY);
+    int to = index(toX, toY);
+
+    withGeometry([&](const auto &geometry) {
+        setMine(fromX, fromY, false);
+
+        int fromCount = 0;
+        geometry.forEachNeighbour(from, [&](int neighbour) {
+            std::uint8_t &cell = cells[neighbour];
+            if (cell & MINE_BIT) {
+                fromCount++;
+            } else {
+                cell--;
+            }
+        });
+        cells[from] = (cells[from] & ~ADJACENT_MASK) | fromCount;
+
+        setMine(toX, toY, true);
+        cells[to] &= ~ADJACENT_MASK;
+
+        geometry.forEachNeighbour(to, [&](int neighbour) {
+            std::uint8_t &cell = cells[neighbour];
+            if (!(cell & MINE_BIT)) {
+                cell++;
+            }
+        });
+    });
+}
+
+/**
+ * @function isOpeningPending
+ * @brief Returns true if the next reveal is the first of the game and will clear its neighbourhood.
+ *
+ * @return True until the first reveal, false afterwards.
+ */
+bool Board::isOpeningPending() const {
+    return openingPending;
+}
+
+/**
+ * @function setOpeningPending
+ * @brief Enables or disables clearing the neighbourhood of the next reveal.
+ *
+ * Boards whose mines must stay exactly where the generator put them (for example boards that are
+ * verified to be solvable from a given start) disable it.
+ *
+ * @param pending True to clear the neighbourhood of the next reveal, false to leave the mines alone.
+ */
+void Board::setOpeningPending(bool pending) {
+    openingPending = pending;
+}
+
+/**
+ * @function cycleMark
+ * @brief Cycles the mark of a hidden cell.
+ *
+ * The mark goes from none to flagged, from flagged to questioned and from questioned back to none.
+ * Revealed cells cannot be marked.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ */
+void Board::cycleMark(int x, int y) {
+    switch (getMark(x, y)) {
+        case Mark::NONE:
+            setMark(x, y, Mark::FLAGGED);
+            break;
+        case Mark::FLAGGED:
+            setMark(x, y, Mark::QUESTIONED);
+            break;
+        default:
+            setMark(x, y, Mark::NONE);
+            break;
+    }
+}
+
+/**
+ * @function setMark
+ * @brief Puts a mark on a hidden cell.
+ *
+ * Revealed cells cannot be marked.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @param mark The new mark of the cell.
+ */
+void Board::setMark(int x, int y, Mark mark) {
+    int i = index(x, y);
+    std::uint8_t &cell = cells[i];
+
+    if (cell & REVEALED_BIT || allRevealed) {
+        return;
+    }
+
+    if (!(cell & MARK_MASK) && mark != Mark::NONE) {
+        touchedCells.push_back(i);
+    }
+    cell = (cell & ~MARK_MASK) | static_cast<std::uint8_t>(static_cast<int>(mark) << MARK_SHIFT);
+}
+
+/**
+ * @function chord
+ * @brief Reveals the hidden, unflagged neighbours of a revealed number whose mines are all flagged.
+ *
+ * Nothing happens unless the cell is revealed and exactly as many of its neighbours are flagged as
+ * it has adjacent mines. Each neighbour is then revealed as by reveal(), so a wrongly placed flag
+ * loses the game.
+ *
+ * @param x The x-coordinate of the revealed cell.
+ * @param y The y-coordinate of the revealed cell.
+ * @param revealedCells Optional list the indices of all newly revealed cells are appended to.
+ * @return MINE if a neighbour was a mine, SAFE if at least one cell was revealed, IGNORED otherwise.
+ */
+Board::RevealResult Board::chord(int x, int y, std::vector<int> *revealedCells) {
+    TRACE_SCOPE("Board::chord");
+    std::uint8_t center = cells[index(x, y)];
+    if (!(center & REVEALED_BIT) || (center & MINE_BIT) || allRevealed || isLost()) {
+        return RevealResult::IGNORED;
+    }
+
+    int neighbours[Topology::MAX_NEIGHBOURS];
+    int neighbourCount = 0;
+    int flags = 0;
+    withGeometry([&](const auto &geometry) {
+        geometry.forEachNeighbour(index(x, y), [&](int neighbour) {
+            if (static_cast<Mark>(cells[neighbour] >> MARK_SHIFT) == Mark::FLAGGED) {
+                flags++;
+            } else {
+                neighbours[neighbourCount++] = neighbour;
+            }
+        });
+    });
+    if (flags != (center & ADJACENT_MASK)) {
+        return RevealResult::IGNORED;
+    }
+
+    RevealResult result = RevealResult::IGNORED;
+    for (int i = 0; i < neighbourCount; i++) {
+        RevealResult neighbour = reveal(neighbours[i] % width, neighbours[i] / width, revealedCells);
+        if (neighbour == RevealResult::MINE) {
+            return RevealResult::MINE;
+        }
+        if (neighbour == RevealResult::SAFE) {
+            result = RevealResult::SAFE;
+        }
+    }
+    return result;
+}
+
+/**
+ * @function revealAll
+ * @brief Reveals every cell on the board.
+ *
+ * Used to show the whole board once the game is over. Does not count towards the revealed safe
+ * cells, so it has no effect on isWon(). Takes constant time: the cells are only flagged as shown,
+ * and no further cell can be revealed or marked until the board is reset.
+ */
+void Board::revealAll() {
+    allRevealed = true;
+}
+
+/**
+ * @function getTouchedCells
+ * @brief Returns the cells the player has revealed or marked since the board was reset.
+ *
+ * Cells can appear more than once, for example a cell that was flagged, cleared and flagged again.
+ * The cells shown by revealAll() are not included.
+ *
+ * @return The board indices of the touched cells, in the order they were touched.
+ */
+const std::vector<int> &Board::getTouchedCells() const {
+    return touchedCells;
+}
+
+/**
+ * @function getRevealedSafeCells
+ * @brief Returns the number of safe cells the player has revealed.
+ *
+ * @return The number of revealed safe cells.
+ */
+int Board::getRevealedSafeCells() const {
+    return revealedSafeCells;
+}
+
+/**
+ * @function isWon
+ * @brief Returns true if every safe cell has been revealed.
+ *
+ * @return True if the game is won, false otherwise.
+ */
+bool Board::isWon() const {
+    return !isLost() && revealedSafeCells == width * height - mineCount;
+}
+
+/**
+ * @function isLost
+ * @brief Returns true if the player has stepped on a mine.
+ *
+ * @return True if the game is lost, false otherwise.
+ */
+bool Board::isLost() const {
+    return explodedIndex != -1;
+}
+
+/**
+ * @function index
+ * @brief Converts a coordinate to an index into the cell array.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The row-major index of the cell.
+ */
+int Board::index(int x, int y) const {
+    return y * width + x;
+}
+
+/**
+ * @function revealCell
+ * @brief Sets the revealed bit of a single hidden cell and clears its mark.
+ *
+ * @param i The index of the cell.
+ * @param revealedCells Optional list the index of the cell is appended to.
+ * @return True if the cell is safe, false if it is a mine.
+ */
+bool Board::revealCell(int i, std::vector<int> *revealedCells) {
+    std::uint8_t &cell = cells[i];
+    touchedCells.push_back(i);
+    cell = (cell & ~MARK_MASK) | REVEALED_BIT;
+
+    if (revealedCells) {
+        revealedCells->push_back(i);
+    }
+
+    if (cell & MINE_BIT) {
+        return false;
+    }
+
+    revealedSafeCells++;
+    return true;
+}
+
+/**
+ * @function withGeometry
+ * @brief Calls a function with the geometry of the board.
+ *
+ * Rectangles of the beginner, intermediate and expert sizes get a FixedGeometry, so the neighbour
+ * loops the function runs are compiled for their exact size, and other rectangles get a
+ * RuntimeGeometry. Other topologies get their neighbour table, which visits neighbours the same
+ * way.
+ *
+ * @param function The function, called with the geometry as its only argument.
+ */
+template<typename Function>
+void Board::withGeometry(Function function) const {
+    static constexpr BoardConfig beginner = BoardConfig::beginner();
+    static constexpr BoardConfig intermediate = BoardConfig::intermediate();
+    static constexpr BoardConfig expert = BoardConfig::expert();
+
+    if (neighbourTable) {
+        function(*neighbourTable);
+    } else if (width == beginner.width && height == beginner.height) {
+        function(FixedGeometry<beginner.width, beginner.height>());
+    } else if (width == intermediate.width && height == intermediate.height) {
+        function(FixedGeometry<intermediate.width, intermediate.height>());
+    } else if (width == expert.width && height == expert.height) {
+        function(FixedGeometry<expert.width, expert.height>());
+    } else {
+        function(RuntimeGeometry({width, height}));
+    }
+}
+
+/**
+ * @function floodFill
+ * @brief Reveals the whole opening around a revealed cell without adjacent mines.
+ *
+ * Every zero cell that gets revealed is pushed on an explicit worklist and its hidden neighbours
+ * are revealed in turn. The revealed bit doubles as the visited set, so each cell is handled at
+ * most once and the call depth stays constant however large the opening is.
+ *
+ * @param geometry The geometry of the board.
+ * @param start The index of the revealed zero cell.
+ * @param revealedCells Optional list the indices of all newly revealed cells are appended to.
+ */
+template<typename Geometry>
+void Board::floodFill(const Geometry &geometry, int start, std::vector<int> *revealedCells) {
+    worklist.clear();
+    worklist.push_back(start);
+
+    while (!worklist.empty()) {
+        int current = worklist.back();
+        worklist.pop_back();
+
+        geometry.forEachNeighbour(current, [&](int neighbour) {
+            if (cells[neighbour] & REVEALED_BIT) return;
+
+            // Neighbours of a zero cell are never mines
+            revealCell(neighbour, revealedCells);
+            if ((cells[neighbour] & ADJACENT_MASK) == 0) {
+                worklist.push_back(neighbour);
+            }
+        });
+    }
+}
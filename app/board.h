@@ -0,0 +1,144 @@
+/**
+ * @file board.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the Board class that holds the complete state of a Minesweeper game.
+ *
+ * Board is a plain C++ engine with no Qt dependency. Every cell is packed into a single byte that
+ * holds its adjacent mine count, mine bit, revealed bit and mark state, so a whole expert board
+ * fits in a few cache lines. The mines are also kept in a bit-plane with one bit per cell, which is
+ * what the adjacency kernels read. Neighbours are defined by a Topology: rectangle boards use loops
+ * compiled for their geometry, wrap-around and hexagonal boards the shared neighbour table of their
+ * shape. Every cell the player reveals or marks is recorded in a touched list, so whoever mirrors
+ * the state of a game can catch up with or forget it in time proportional to the moves played
+ * rather than to the size of the board. The GUI classes (GameLogicHandler and BoardView) are thin
+ * views over it, and bots or analysis tools can drive it directly without creating any widgets.
+ */
+
+#ifndef QT_MINESWEEPER_BOARD_H
+#define QT_MINESWEEPER_BOARD_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "topology.h"
+
+class Board {
+public:
+
+    enum class Mark : std::uint8_t {
+        NONE,
+        FLAGGED,
+        QUESTIONED
+    };
+
+    enum class RevealResult {
+        IGNORED, // The cell was already revealed or the game is already over
+        SAFE,
+        MINE
+    };
+
+    Board(int width, int height, int mineCount, Topology::Kind topology = Topology::Kind::RECTANGLE);
+
+    void reset();
+
+    int getWidth() const;
+
+    int getHeight() const;
+
+    int getMineCount() const;
+
+    Topology::Kind getTopology() const;
+
+    std::uint64_t getSeed() const;
+
+    void setSeed(std::uint64_t seed);
+
+    bool contains(int x, int y) const;
+
+    bool isMine(int x, int y) const;
+
+    void setMine(int x, int y, bool mine);
+
+    int getAdjacentMines(int x, int y) const;
+
+    bool isRevealed(int x, int y) const;
+
+    bool isExploded(int x, int y) const;
+
+    Mark getMark(int x, int y) const;
+
+    const std::uint64_t *getMinePlane() const;
+
+    int getWordsPerRow() const;
+
+    void calculateAdjacentMines();
+
+    void calculateAdjacentMines(int firstRow, int endRow);
+
+    RevealResult reveal(int x, int y, std::vector<int> *revealedCells = nullptr);
+
+    void clearOpening(int x, int y);
+
+    void moveMine(int fromX, int fromY, int toX, int toY);
+
+    bool isOpeningPending() const;
+
+    void setOpeningPending(bool pending);
+
+    RevealResult chord(int x, int y, std::vector<int> *revealedCells = nullptr);
+
+    void cycleMark(int x, int y);
+
+    void setMark(int x, int y, Mark mark);
+
+    void revealAll();
+
+    const std::vector<int> &getTouchedCells() const;
+
+    int getRevealedSafeCells() const;
+
+    bool isWon() const;
+
+    bool isLost() const;
+
+private:
+
+    friend class Snapshot; // Saves and restores the private state as it is
+    friend class ReplayEngine; // Restores the state stored at a replay checkpoint
+
+    // Layout of a packed cell byte
+    static constexpr std::uint8_t ADJACENT_MASK = 0x0F; // bits 0-3: adjacent mines [0, 8]
+    static constexpr std::uint8_t MINE_BIT = 0x10;
+    static constexpr std::uint8_t REVEALED_BIT = 0x20;
+    static constexpr int MARK_SHIFT = 6; // bits 6-7: Mark
+    static constexpr std::uint8_t MARK_MASK = 0xC0;
+
+    int index(int x, int y) const;
+
+    bool revealCell(int i, std::vector<int> *revealedCells);
+
+    template<typename Function>
+    void withGeometry(Function function) const;
+
+    template<typename Geometry>
+    void floodFill(const Geometry &geometry, int start, std::vector<int> *revealedCells);
+
+    int width;
+    int height;
+    int mineCount;
+    Topology::Kind topology;
+    std::shared_ptr<const Topology> neighbourTable; // nullptr for rectangles, which do not need one
+    int wordsPerRow; // Words per row of the mine bit-plane
+    std::uint64_t seed; // Seed the mine layout was generated from
+    int revealedSafeCells;
+    int explodedIndex; // -1 while no mine has been stepped on
+    bool openingPending; // True until the first reveal has cleared its neighbourhood
+    bool allRevealed; // Set by revealAll(), which shows every cell without touching their bytes
+    std::vector<std::uint8_t> cells; // row-major, index = y * width + x
+    std::vector<std::uint64_t> minePlane; // bit x % 64 of word y * wordsPerRow + x / 64
+    std::vector<int> touchedCells; // Cells revealed or marked since the last reset, possibly repeated
+    std::vector<int> worklist; // Zero cells whose neighbours still have to be opened, reused across reveals
+};
+
+#endif //QT_MINESWEEPER_BOARD_H
@@ -0,0 +1,51 @@
+/**
+ * @file boardconfig.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the BoardConfig struct that describes the size, mine count and topology of a
+ *        board.
+ *
+ * The presets match the classic difficulties; expert is the board described by constants.h. Any
+ * other size up to MAX_CELLS cells can be used as well, on any Topology.
+ */
+
+#ifndef QT_MINESWEEPER_BOARDCONFIG_H
+#define QT_MINESWEEPER_BOARDCONFIG_H
+
+#include "constants.h"
+#include "topology.h"
+
+struct BoardConfig {
+
+    static constexpr long long MAX_CELLS = 1LL << 28; // Keeps every cell index within an int
+
+    int width;
+    int height;
+    int mineCount;
+    Topology::Kind topology = Topology::Kind::RECTANGLE;
+
+    static constexpr BoardConfig beginner() {
+        return {9, 9, 10};
+    }
+
+    static constexpr BoardConfig intermediate() {
+        return {16, 16, 40};
+    }
+
+    static constexpr BoardConfig expert() {
+        return {GRID_WIDTH, GRID_HEIGHT, NUMBER_OF_MINES};
+    }
+
+    constexpr long long getCellCount() const {
+        return static_cast<long long>(width) * height;
+    }
+
+    constexpr bool isValid() const {
+        return width > 0 && height > 0 && getCellCount() <= MAX_CELLS && mineCount >= 0 &&
+               mineCount <= getCellCount();
+    }
+
+    constexpr bool operator==(const BoardConfig &other) const = default;
+};
+
+#endif //QT_MINESWEEPER_BOARDCONFIG_H
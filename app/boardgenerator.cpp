@@ -0,0 +1,232 @@
+/**
+ * @file boardgenerator.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the BoardGenerator class, which places mines from a seed and computes
+ *        the adjacent mine counts of a new board, band by band and in parallel.
+ */
+
+#include <algorithm>
+#include <vector>
+#include "boardgenerator.h"
+#include "trace.h"
+
+/**
+ * @function BoardGenerator
+ * @brief Constructs a BoardGenerator.
+ *
+ * @param pool The pool the bands of large boards are spread over, or nullptr to generate every
+ *             board on the calling thread. The result does not depend on it.
+ */
+BoardGenerator::BoardGenerator(ThreadPool *pool) : pool(pool) {}
+
+/**
+ * @function ~BoardGenerator
+ * @brief Destructor for BoardGenerator.
+ *
+ * The pool is not owned by the generator.
+ */
+BoardGenerator::~BoardGenerator() = default;
+
+/**
+ * @function generate
+ * @brief Turns a freshly reset board into a new game.
+ *
+ * Places the mines for the given seed and calculates the adjacent mine counts.
+ *
+ * @param board The board to fill. It must be empty, e.g. just constructed or reset.
+ * @param seed The seed the layout is derived from.
+ */
+void BoardGenerator::generate(Board &board, std::uint64_t seed) const {
+    TRACE_SCOPE("BoardGenerator::generate");
+    placeMines(board, seed);
+    calculateAdjacentMines(board);
+}
+
+/**
+ * @function placeMines
+ * @brief Places the board's mines uniformly at random.
+ *
+ * First the mine count of every band is drawn, in band order, from one Random seeded with the
+ * seed. Then each band chooses its mine cells with Floyd's algorithm: for each of the last k cell
+ * indices j of the band, a cell t in [0, j] is drawn; t gets the mine unless it already has one, in
+ * which case j gets it. Every subset is equally likely and exactly one draw is needed per mine, so
+ * dense boards are as fast as sparse ones. The board itself serves as the membership set, and since
+ * bands own whole rows they can be filled concurrently.
+ *
+ * @param board The board to place the mines on. It must not contain any mines yet.
+ * @param seed The seed the layout is derived from.
+ */
+void BoardGenerator::placeMines(Board &board, std::uint64_t seed) const {
+    int width = board.getWidth();
+    int height = board.getHeight();
+    int rowsPerBand = getRowsPerBand(width);
+    int bandCount = (height + rowsPerBand - 1) / rowsPerBand;
+
+    std::vector<int> bandMines(bandCount);
+    Random random(seed);
+    long long remainingCells = static_cast<long long>(width) * height;
+    long long remainingMines = board.getMineCount();
+
+    for (int band = 0; band < bandCount; band++) {
+        long long bandCells = static_cast<long long>(width) * std::min(rowsPerBand, height - band * rowsPerBand);
+        long long mines = band + 1 == bandCount ? remainingMines
+                                                : sampleHypergeometric(random, remainingCells, remainingMines,
+                                                                       bandCells);
+        bandMines[band] = static_cast<int>(mines);
+        remainingCells -= bandCells;
+        remainingMines -= mines;
+    }
+
+    std::uint64_t bandSeedBase = Random::mix(seed);
+
+    forEachBand(bandCount, [&](int band) {
+        Random bandRandom(bandSeedBase + band);
+        int firstRow = band * rowsPerBand;
+        int bandCells = width * std::min(rowsPerBand, height - firstRow);
+
+        for (int j = bandCells - bandMines[band]; j < bandCells; j++) {
+            auto t = static_cast<int>(bandRandom.nextBelow(j + 1));
+
+            if (board.isMine(t % width, firstRow + t / width)) {
+                t = j;
+            }
+
+            board.setMine(t % width, firstRow + t / width, true);
+        }
+    });
+
+    board.setSeed(seed);
+}
+
+/**
+ * @function calculateAdjacentMines
+ * @brief Calculates the adjacent mine counts of the whole board, one band per task.
+ *
+ * Each band reads the mine rows just outside it but only writes its own cells, so the borders
+ * between bands come out exactly as if the board was calculated in one piece.
+ *
+ * @param board The board whose mines are placed.
+ */
+void BoardGenerator::calculateAdjacentMines(Board &board) const {
+    int height = board.getHeight();
+    int rowsPerBand = getRowsPerBand(board.getWidth());
+    int bandCount = (height + rowsPerBand - 1) / rowsPerBand;
+
+    forEachBand(bandCount, [&](int band) {
+        int firstRow = band * rowsPerBand;
+        board.calculateAdjacentMines(firstRow, std::min(height, firstRow + rowsPerBand));
+    });
+}
+
+/**
+ * @function getRowsPerBand
+ * @brief Returns the number of rows in a band of a board of the given width.
+ *
+ * @param width The number of cells in a row.
+ * @return The number of whole rows that make up about BAND_CELLS cells, at least one.
+ */
+int BoardGenerator::getRowsPerBand(int width) {
+    return std::max(1, BAND_CELLS / std::max(1, width));
+}
+
+/**
+ * @function sampleHypergeometric
+ * @brief Draws how many mines fall into a band.
+ *
+ * Returns the number of successes when drawing `draws` items without replacement from a population
+ * containing `successes` successes. Uses inversion starting at the mode and walking outwards, with
+ * the weight of each count derived from its neighbour by the exact ratio of their probabilities,
+ * so the expected cost is proportional to the standard deviation rather than to the band size. The
+ * weights are taken relative to the mode and summed in a first walk instead of being normalized
+ * with lgamma and exp, whose results differ between math libraries. Only additions,
+ * multiplications and divisions are used, which IEEE 754 rounds the same way on every platform, so
+ * the same seed gives the same count everywhere.
+ *
+ * @param random The generator to draw from.
+ * @param population The number of cells left to distribute mines over.
+ * @param successes The number of mines left.
+ * @param draws The number of cells in the band.
+ * @return The number of mines in the band.
+ */
+long long BoardGenerator::sampleHypergeometric(Random &random, long long population, long long successes,
+                                               long long draws) {
+    long long failures = population - successes;
+    long long low = std::max(0LL, draws - failures);
+    long long high = std::min(draws, successes);
+
+    if (low >= high) {
+        return low;
+    }
+
+    long long mode = std::clamp((draws + 1) * (successes + 1) / (population + 2), low, high);
+
+    // Visits the counts from the mode outwards, alternating down and up, with their weights relative
+    // to the mode. The distribution is unimodal, so once a side falls below a weight that no 53-bit
+    // draw can tell from zero, the rest of that side can be skipped as well.
+    constexpr double NEGLIGIBLE = 0x1.0p-60;
+    auto walk = [&](auto visit) {
+        if (visit(mode, 1.0)) {
+            return mode;
+        }
+
+        double downWeight = 1.0;
+        double upWeight = 1.0;
+        long long down = mode;
+        long long up = mode;
+
+        while ((down > low && downWeight >= NEGLIGIBLE) || (up < high && upWeight >= NEGLIGIBLE)) {
+            if (down > low && downWeight >= NEGLIGIBLE) {
+                double numerator = static_cast<double>(down) * static_cast<double>(failures - draws + down);
+                double denominator = static_cast<double>(successes - down + 1) * static_cast<double>(draws - down + 1);
+                downWeight *= numerator / denominator;
+                down--;
+                if (visit(down, downWeight)) {
+                    return down;
+                }
+            }
+
+            if (up < high && upWeight >= NEGLIGIBLE) {
+                double numerator = static_cast<double>(successes - up) * static_cast<double>(draws - up);
+                double denominator = static_cast<double>(up + 1) * static_cast<double>(failures - draws + up + 1);
+                upWeight *= numerator / denominator;
+                up++;
+                if (visit(up, upWeight)) {
+                    return up;
+                }
+            }
+        }
+        return mode;
+    };
+
+    double total = 0;
+    walk([&](long long, double weight) {
+        total += weight;
+        return false;
+    });
+
+    // The second walk adds the same weights in the same order, so it reaches total at its last count
+    double target = static_cast<double>(random.next() >> 11) * 0x1.0p-53 * total;
+    double sum = 0;
+    return walk([&](long long, double weight) {
+        sum += weight;
+        return sum > target;
+    });
+}
+
+/**
+ * @function forEachBand
+ * @brief Runs a task for every band, on the pool if there is one.
+ *
+ * @param bandCount The number of bands.
+ * @param task The task to run for each band index.
+ */
+void BoardGenerator::forEachBand(int bandCount, const std::function<void(int)> &task) const {
+    if (pool) {
+        pool->parallelFor(bandCount, task);
+    } else {
+        for (int band = 0; band < bandCount; band++) {
+            task(band);
+        }
+    }
+}
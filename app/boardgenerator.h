@@ -0,0 +1,51 @@
+/**
+ * @file boardgenerator.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the BoardGenerator class that lays out the mines of a new game.
+ *
+ * The board is split into bands of whole rows of about BAND_CELLS cells each. The number of mines
+ * in every band is drawn up front from the hypergeometric distribution, which is exactly how many
+ * mines a uniformly random layout puts there. Each band then places its own mines with Robert
+ * Floyd's sampling algorithm, driven by a Random derived from the seed and the band number, and the
+ * adjacent counts are calculated band by band. Bands are independent, so they are spread over a
+ * ThreadPool, and because the bands do not depend on the number of threads the same seed always
+ * reproduces the same board.
+ */
+
+#ifndef QT_MINESWEEPER_BOARDGENERATOR_H
+#define QT_MINESWEEPER_BOARDGENERATOR_H
+
+#include <cstdint>
+#include "board.h"
+#include "random.h"
+#include "threadpool.h"
+
+class BoardGenerator {
+public:
+
+    static constexpr int BAND_CELLS = 1 << 16;
+
+    explicit BoardGenerator(ThreadPool *pool = nullptr);
+
+    ~BoardGenerator();
+
+    void generate(Board &board, std::uint64_t seed) const;
+
+    void placeMines(Board &board, std::uint64_t seed) const;
+
+    void calculateAdjacentMines(Board &board) const;
+
+private:
+
+    static int getRowsPerBand(int width);
+
+    static long long sampleHypergeometric(Random &random, long long population, long long successes,
+                                          long long draws);
+
+    void forEachBand(int bandCount, const std::function<void(int)> &task) const;
+
+    ThreadPool *pool; // Runs the bands; nullptr runs them on the calling thread
+};
+
+#endif //QT_MINESWEEPER_BOARDGENERATOR_H
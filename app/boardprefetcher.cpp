@@ -0,0 +1,152 @@
+/**
+ * @file boardprefetcher.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the BoardPrefetcher class, which keeps a queue of ready boards filled
+ *        from a background thread.
+ */
+
+#include <algorithm>
+#include "boardprefetcher.h"
+
+/**
+ * @function BoardPrefetcher
+ * @brief Constructs a BoardPrefetcher and starts its worker thread.
+ *
+ * The worker stays idle until configure() tells it what to generate.
+ *
+ * @param seed The seed the seeds of the generated boards are drawn from.
+ * @param capacity The number of boards to keep ready, at least 1.
+ */
+BoardPrefetcher::BoardPrefetcher(std::uint64_t seed, int capacity)
+        : config{0, 0, 0}, capacity(std::max(1, capacity)), epoch(0), seeds(seed),
+          worker([this](std::stop_token stop) { workerLoop(stop); }) {}
+
+/**
+ * @function ~BoardPrefetcher
+ * @brief Destructor for BoardPrefetcher.
+ *
+ * Cancels the board that is being generated and waits for the worker thread to finish.
+ */
+BoardPrefetcher::~BoardPrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        current.request_stop();
+    }
+    worker.request_stop();
+    worker.join();
+}
+
+/**
+ * @function configure
+ * @brief Sets the size of the boards and how they are generated.
+ *
+ * Boards that are ready are dropped and the board that is being generated is cancelled, so every
+ * board taken afterwards matches the new settings.
+ *
+ * @param config The size and mine count of the boards. Must be valid.
+ * @param generate Fills a reset board of that size from a seed. It runs on the worker thread and
+ *                 should return early when its stop token is triggered.
+ */
+void BoardPrefetcher::configure(const BoardConfig &config, Generate generate) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->config = config;
+        this->generate = std::move(generate);
+        epoch++;
+        ready.clear();
+        current.request_stop();
+    }
+    changed.notify_all();
+}
+
+/**
+ * @function setCapacity
+ * @brief Sets the number of boards to keep ready.
+ *
+ * Lowering it drops the boards that no longer fit.
+ *
+ * @param capacity The number of boards to keep ready, at least 1.
+ */
+void BoardPrefetcher::setCapacity(int capacity) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->capacity = std::max(1, capacity);
+        while (static_cast<int>(ready.size()) > this->capacity) {
+            ready.pop_back();
+        }
+    }
+    changed.notify_all();
+}
+
+/**
+ * @function getReadyCount
+ * @brief Returns the number of boards that are ready to be taken.
+ *
+ * @return The number of ready boards.
+ */
+int BoardPrefetcher::getReadyCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<int>(ready.size());
+}
+
+/**
+ * @function take
+ * @brief Takes the oldest ready board off the queue, without waiting.
+ *
+ * The worker starts on a replacement right away.
+ *
+ * @return The board, or nothing if no board is ready yet.
+ */
+std::optional<Board> BoardPrefetcher::take() {
+    std::optional<Board> board;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (ready.empty()) {
+            return board;
+        }
+
+        board.emplace(std::move(ready.front()));
+        ready.pop_front();
+    }
+    changed.notify_all();
+    return board;
+}
+
+/**
+ * @function workerLoop
+ * @brief Generates boards until the queue is full, then waits for a board to be taken.
+ *
+ * The settings are copied under the lock and the board is generated without it, so taking a board
+ * or changing the settings never waits for a generation to finish.
+ *
+ * @param stop Triggered when the prefetcher is destroyed.
+ */
+void BoardPrefetcher::workerLoop(std::stop_token stop) {
+    while (true) {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, stop, [this] {
+            return generate && static_cast<int>(ready.size()) < capacity;
+        });
+        if (stop.stop_requested()) {
+            return;
+        }
+
+        BoardConfig boardConfig = config;
+        Generate boardGenerate = generate;
+        std::uint64_t boardEpoch = epoch;
+        std::uint64_t seed = seeds.next();
+        current = std::stop_source();
+        std::stop_token boardStop = current.get_token();
+        lock.unlock();
+
+        Board board(boardConfig.width, boardConfig.height, boardConfig.mineCount, boardConfig.topology);
+        bool generated = boardGenerate(board, seed, boardStop);
+
+        lock.lock();
+        if (generated && !boardStop.stop_requested() && boardEpoch == epoch &&
+            static_cast<int>(ready.size()) < capacity) {
+            ready.push_back(std::move(board));
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * @file boardprefetcher.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the BoardPrefetcher class that generates upcoming boards on a background thread.
+ *
+ * A worker thread keeps a small queue of ready boards filled while the current game is played, so
+ * starting a new game only has to take a board off the queue, however long it took to generate.
+ * How a board is generated (regular, no-guess, ...) is passed in as a function together with the
+ * board size. Changing them empties the queue and cancels the board that is being generated
+ * through its std::stop_token; a board that still finishes under the old settings is thrown away,
+ * which an epoch counter that every change bumps makes easy to tell.
+ */
+
+#ifndef QT_MINESWEEPER_BOARDPREFETCHER_H
+#define QT_MINESWEEPER_BOARDPREFETCHER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include "board.h"
+#include "boardconfig.h"
+#include "random.h"
+
+class BoardPrefetcher {
+public:
+
+    // Fills a reset board from a seed; returns false if it was stopped or failed
+    using Generate = std::function<bool(Board &board, std::uint64_t seed, std::stop_token stop)>;
+
+    explicit BoardPrefetcher(std::uint64_t seed, int capacity = 1);
+
+    ~BoardPrefetcher();
+
+    BoardPrefetcher(const BoardPrefetcher &) = delete;
+
+    BoardPrefetcher &operator=(const BoardPrefetcher &) = delete;
+
+    BoardPrefetcher(BoardPrefetcher &&) = delete;
+
+    BoardPrefetcher &operator=(BoardPrefetcher &&) = delete;
+
+    void configure(const BoardConfig &config, Generate generate);
+
+    void setCapacity(int capacity);
+
+    int getReadyCount() const;
+
+    std::optional<Board> take();
+
+private:
+
+    void workerLoop(std::stop_token stop);
+
+    mutable std::mutex mutex;
+    std::condition_variable_any changed;
+    BoardConfig config;
+    Generate generate; // Empty until the first call to configure()
+    int capacity;
+    std::uint64_t epoch; // Bumped by every configure(), so stale boards can be recognised
+    Random seeds;
+    std::deque<Board> ready;
+    std::stop_source current; // Cancels the board that is being generated
+    std::jthread worker; // Last member, so it starts after and stops before the others
+};
+
+#endif //QT_MINESWEEPER_BOARDPREFETCHER_H
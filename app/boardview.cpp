@@ -0,0 +1,736 @@
+/**
+ * @file boardview.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the BoardView class, which paints the visible part of the game grid from
+ *        a sprite atlas or as blended colours, and turns mouse clicks into reveal and mark requests.
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <QImage>
+#include <QPainter>
+#include <QScrollBar>
+#include <QtMath>
+#include "boardview.h"
+#include "constants.h"
+#include "pixmapcache.h"
+#include "trace.h"
+
+namespace {
+
+struct ZoomLevel {
+    qreal pitch; // Distance between the origins of two cells in pixels
+    int tileSize; // Width and height of a sprite in pixels, 0 for the levels drawn as blended colours
+};
+
+// From the farthest out to the closest in. Sprites smaller than 8 pixels are unreadable, so the
+// levels below are blended; at those levels cells have no spacing, and below one pixel per cell
+// every pixel covers a square block of cells.
+constexpr ZoomLevel ZOOM_LEVELS[] = {
+        {1.0 / 16, 0},
+        {1.0 / 8, 0},
+        {1.0 / 4, 0},
+        {1.0 / 2, 0},
+        {1, 0},
+        {2, 0},
+        {4, 0},
+        {8 + TILE_SPACING, 8},
+        {12 + TILE_SPACING, 12},
+        {16 + TILE_SPACING, 16},
+        {22 + TILE_SPACING, 22},
+        {TILE_SIZE + TILE_SPACING, TILE_SIZE},
+        {45 + TILE_SPACING, 45},
+        {60 + TILE_SPACING, 60}
+};
+constexpr int ZOOM_LEVEL_COUNT = static_cast<int>(std::size(ZOOM_LEVELS));
+constexpr int DEFAULT_ZOOM_LEVEL = 11;
+constexpr int FIRST_DETAILED_LEVEL = 7;
+static_assert(ZOOM_LEVELS[DEFAULT_ZOOM_LEVEL].tileSize == TILE_SIZE, "the default zoom shows tiles at their size");
+static_assert(ZOOM_LEVELS[FIRST_DETAILED_LEVEL].tileSize > 0 && ZOOM_LEVELS[FIRST_DETAILED_LEVEL - 1].tileSize == 0,
+              "FIRST_DETAILED_LEVEL is the first level with sprites");
+
+constexpr int BLEND_SAMPLES = 4; // Cells sampled per side of the block behind a blended pixel
+constexpr qreal MAX_CONTENT_SIZE = std::numeric_limits<int>::max() / 2; // Leaves room to add viewport coordinates
+constexpr int MIN_HINT_SIZE = 8; // The hint highlight is never smaller than this, so it stays visible
+
+}
+
+/**
+ * @function BoardView
+ * @brief Constructs a BoardView at the default zoom level, or the closest one the board fits in.
+ *
+ * @param board The board this widget is a view of. It must outlive the view.
+ * @param parent The parent widget.
+ */
+BoardView::BoardView(const Board &board, QWidget *parent)
+        : QAbstractScrollArea(parent), board(board), atlasPixelRatio(0), atlasTileSize(0),
+          zoomLevel(DEFAULT_ZOOM_LEVEL), hintCell(-1), deferredCount(0) {
+    setFrameShape(QFrame::NoFrame);
+    viewport()->setAttribute(Qt::WA_OpaquePaintEvent);
+    zoomLevel = std::min(zoomLevel, getMaxZoomLevel());
+    updateScrollBars();
+    buildAtlas();
+}
+
+/**
+ * @function ~BoardView
+ * @brief Destructor for BoardView.
+ *
+ * The atlas is a value member, so there is nothing to clean up explicitly.
+ */
+BoardView::~BoardView() = default;
+
+/**
+ * @function sizeHint
+ * @brief Returns the size that shows the whole board at the current zoom level.
+ *
+ * The window system caps the initial size of a window to the screen, and the scroll bars take
+ * over from there.
+ *
+ * @return The preferred size of the view.
+ */
+QSize BoardView::sizeHint() const {
+    return contentSize() + QSize(2 * frameWidth(), 2 * frameWidth());
+}
+
+/**
+ * @function cellRect
+ * @brief Returns the viewport rectangle a cell is drawn in.
+ *
+ * At the blended zoom levels a cell may share its pixel with its neighbours, and the rectangle is
+ * that pixel.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The rectangle of the cell in viewport coordinates, which may lie outside the viewport.
+ */
+QRect BoardView::cellRect(int x, int y) const {
+    const ZoomLevel &zoom = ZOOM_LEVELS[zoomLevel];
+    int size = zoom.tileSize > 0 ? zoom.tileSize : std::max(1, qCeil(zoom.pitch));
+    return {qFloor(x * zoom.pitch) - horizontalScrollBar()->value(),
+            qFloor(y * zoom.pitch) - verticalScrollBar()->value(), size, size};
+}
+
+/**
+ * @function ensureCellVisible
+ * @brief Scrolls a cell into the middle of the viewport, unless it is visible already.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ */
+void BoardView::ensureCellVisible(int x, int y) {
+    QRect rect = cellRect(x, y);
+
+    if (rect.left() < 0 || rect.right() >= viewport()->width()) {
+        horizontalScrollBar()->setValue(horizontalScrollBar()->value() + rect.center().x() - viewport()->width() / 2);
+    }
+    if (rect.top() < 0 || rect.bottom() >= viewport()->height()) {
+        verticalScrollBar()->setValue(verticalScrollBar()->value() + rect.center().y() - viewport()->height() / 2);
+    }
+}
+
+/**
+ * @function getZoomLevel
+ * @brief Gets the current zoom level.
+ *
+ * @return The zoom level, from 0 (farthest out) to the number of levels minus one.
+ */
+int BoardView::getZoomLevel() const {
+    return zoomLevel;
+}
+
+/**
+ * @function setZoomLevel
+ * @brief Zooms to a level, keeping the cell in the middle of the viewport in place.
+ *
+ * @param level The zoom level, clamped to the levels the board fits in.
+ */
+void BoardView::setZoomLevel(int level) {
+    zoomAround(level, viewport()->rect().center());
+}
+
+/**
+ * @function isDetailed
+ * @brief Checks whether cells are drawn as sprites rather than blended colours.
+ *
+ * @return True at the zoom levels that draw sprites, false at the level-of-detail ones.
+ */
+bool BoardView::isDetailed() const {
+    return ZOOM_LEVELS[zoomLevel].tileSize > 0;
+}
+
+/**
+ * @function updateCells
+ * @brief Schedules a repaint of a batch of changed cells.
+ *
+ * Only the bounding rectangle of the batch is invalidated, so a single reveal repaints a single
+ * tile and an opening repaints the area it covers; the part outside the viewport costs nothing.
+ * Cells of the batch that were deferred are shown from now on. Any move also removes the hint
+ * highlight.
+ *
+ * @param cells The board indices of the cells that changed.
+ */
+void BoardView::updateCells(const std::vector<int> &cells) {
+    clearHint();
+
+    if (cells.empty()) {
+        return;
+    }
+
+    int width = board.getWidth();
+    int minX = width, minY = board.getHeight(), maxX = -1, maxY = -1;
+    for (int cell: cells) {
+        if (deferredCount > 0 && deferredCells[cell]) {
+            deferredCells[cell] = false;
+            deferredCount--;
+        }
+        int x = cell % width;
+        int y = cell / width;
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
+    }
+
+    viewport()->update(cellRect(minX, minY).united(cellRect(maxX, maxY)));
+}
+
+/**
+ * @function updateAll
+ * @brief Schedules a repaint of the visible part of the board.
+ *
+ * Also adapts the zoom level and the scroll range, in case the board was replaced by one of a
+ * different size, and removes the hint highlight and any deferred cells.
+ */
+void BoardView::updateAll() {
+    hintCell = -1;
+    deferredCells.clear();
+    deferredCount = 0;
+    zoomLevel = std::min(zoomLevel, getMaxZoomLevel());
+    updateScrollBars();
+    updateGeometry();
+    viewport()->update();
+}
+
+/**
+ * @function deferCells
+ * @brief Keeps drawing cells as hidden until updateCells() is called with them.
+ *
+ * Used for the cells of a move that reach the view in slices, so that a repaint in the meantime,
+ * such as a scroll, does not show them early.
+ *
+ * @param cells The board indices of the cells.
+ */
+void BoardView::deferCells(const std::vector<int> &cells) {
+    auto size = static_cast<std::size_t>(board.getWidth()) * board.getHeight();
+    if (deferredCells.size() != size) {
+        deferredCells.assign(size, false);
+        deferredCount = 0;
+    }
+
+    for (int cell: cells) {
+        if (!deferredCells[cell]) {
+            deferredCells[cell] = true;
+            deferredCount++;
+        }
+    }
+}
+
+/**
+ * @function zoomIn
+ * @brief Zooms in by one level around the middle of the viewport.
+ */
+void BoardView::zoomIn() {
+    setZoomLevel(zoomLevel + 1);
+}
+
+/**
+ * @function zoomOut
+ * @brief Zooms out by one level around the middle of the viewport.
+ */
+void BoardView::zoomOut() {
+    setZoomLevel(zoomLevel - 1);
+}
+
+/**
+ * @function resetZoom
+ * @brief Returns to the zoom level that shows tiles at their natural size.
+ */
+void BoardView::resetZoom() {
+    setZoomLevel(DEFAULT_ZOOM_LEVEL);
+}
+
+/**
+ * @function paintEvent
+ * @brief Paints the cells that intersect the dirty rectangle of the viewport.
+ *
+ * @param event The QPaintEvent object containing the rectangle to repaint.
+ */
+void BoardView::paintEvent(QPaintEvent *event) {
+    TRACE_SCOPE("BoardView::paintEvent");
+    QPainter painter(viewport());
+    QRect dirty = event->rect();
+    painter.fillRect(dirty, palette().window());
+
+    if (isDetailed()) {
+        paintSprites(painter, dirty);
+    } else {
+        paintBlocks(painter, dirty);
+    }
+
+    if (hintCell >= 0) {
+        QRect hint = hintRect();
+        if (dirty.intersects(hint)) {
+            painter.setPen(QPen(palette().highlight(), 2));
+            painter.drawRect(hint.adjusted(1, 1, -1, -1));
+        }
+    }
+}
+
+/**
+ * @function mousePressEvent
+ * @brief Handles the mouse press event.
+ *
+ * Maps the click position to a cell. If the right mouse button is pressed, a mark change is
+ * requested for that cell, and the middle button requests a chord on it; any other button requests
+ * a reveal. Clicks on the spacing between tiles are ignored. When cells are smaller than a pixel
+ * there is no telling which one was meant, so a left click zooms in on the spot instead.
+ *
+ * @param event The QMouseEvent object containing details about the mouse event.
+ */
+void BoardView::mousePressEvent(QMouseEvent *event) {
+    TRACE_SCOPE("BoardView::mousePressEvent");
+    QPoint position = event->position().toPoint();
+
+    if (ZOOM_LEVELS[zoomLevel].pitch < 1) {
+        if (event->button() == Qt::LeftButton) {
+            zoomAround(FIRST_DETAILED_LEVEL, position);
+        }
+        return;
+    }
+
+    QPoint cell = cellAt(position);
+    if (!board.contains(cell.x(), cell.y()) || !cellRect(cell.x(), cell.y()).contains(position)) {
+        return;
+    }
+
+    if (event->button() == Qt::RightButton) {
+        emit markRequested(cell.x(), cell.y());
+    } else if (event->button() == Qt::MiddleButton) {
+        emit chordRequested(cell.x(), cell.y());
+    } else {
+        emit revealRequested(cell.x(), cell.y());
+    }
+}
+
+/**
+ * @function wheelEvent
+ * @brief Zooms around the mouse pointer when Ctrl is held, and scrolls otherwise.
+ *
+ * @param event The QWheelEvent object containing details about the wheel event.
+ */
+void BoardView::wheelEvent(QWheelEvent *event) {
+    if (!(event->modifiers() & Qt::ControlModifier)) {
+        QAbstractScrollArea::wheelEvent(event);
+        return;
+    }
+
+    int delta = event->angleDelta().y();
+    if (delta != 0) {
+        zoomAround(zoomLevel + (delta > 0 ? 1 : -1), event->position().toPoint());
+    }
+    event->accept();
+}
+
+/**
+ * @function resizeEvent
+ * @brief Adapts the scroll range to the new size of the viewport.
+ *
+ * @param event The QResizeEvent object containing the old and new sizes.
+ */
+void BoardView::resizeEvent(QResizeEvent *event) {
+    QAbstractScrollArea::resizeEvent(event);
+    updateScrollBars();
+}
+
+/**
+ * @function scrollContentsBy
+ * @brief Moves the viewport contents after a scroll.
+ *
+ * The pixels that stay visible are moved rather than painted again, so panning only paints the
+ * strips that scroll into view.
+ *
+ * @param dx The horizontal distance scrolled, in pixels.
+ * @param dy The vertical distance scrolled, in pixels.
+ */
+void BoardView::scrollContentsBy(int dx, int dy) {
+    viewport()->scroll(dx, dy);
+}
+
+/**
+ * @function buildAtlas
+ * @brief Builds the sprite atlas from the image assets for the tile size of the zoom level.
+ *
+ * Every asset is taken from the shared PixmapCache, already scaled to the tile size at the current
+ * device pixel ratio, and drawn into its own slot of a single pixmap. Painting then only copies
+ * rectangles out of the atlas.
+ */
+void BoardView::buildAtlas() {
+    TRACE_SCOPE("BoardView::buildAtlas");
+    atlasPixelRatio = devicePixelRatioF();
+    atlasTileSize = ZOOM_LEVELS[zoomLevel].tileSize;
+    if (atlasTileSize == 0) {
+        atlas = QPixmap();
+        return;
+    }
+    int spritePixels = qRound(atlasTileSize * atlasPixelRatio);
+
+    atlas = QPixmap(spritePixels * SPRITE_COUNT, spritePixels);
+    atlas.fill(Qt::transparent);
+
+    QPainter painter(&atlas);
+    for (int sprite = 0; sprite < SPRITE_COUNT; sprite++) {
+        QPixmap pixmap = PixmapCache::instance().pixmap(SPRITE_PATHS[sprite], atlasTileSize, atlasPixelRatio);
+        if (pixmap.isNull()) {
+            continue;
+        }
+
+        // The atlas has no device pixel ratio of its own, so place the sprite in device pixels
+        painter.drawPixmap(QRect(sprite * spritePixels + (spritePixels - pixmap.width()) / 2,
+                                 (spritePixels - pixmap.height()) / 2, pixmap.width(), pixmap.height()), pixmap);
+    }
+}
+
+/**
+ * @function updateScrollBars
+ * @brief Sets the scroll ranges so that the board can be scrolled from edge to edge.
+ */
+void BoardView::updateScrollBars() {
+    QSize content = contentSize();
+    QSize visible = viewport()->size();
+    int step = std::max(1, qCeil(ZOOM_LEVELS[zoomLevel].pitch));
+
+    horizontalScrollBar()->setRange(0, std::max(0, content.width() - visible.width()));
+    horizontalScrollBar()->setPageStep(visible.width());
+    horizontalScrollBar()->setSingleStep(step);
+    verticalScrollBar()->setRange(0, std::max(0, content.height() - visible.height()));
+    verticalScrollBar()->setPageStep(visible.height());
+    verticalScrollBar()->setSingleStep(step);
+}
+
+/**
+ * @function contentSize
+ * @brief Returns the size of the whole board at the current zoom level.
+ *
+ * @return The size in pixels, without the spacing after the last row and column.
+ */
+QSize BoardView::contentSize() const {
+    const ZoomLevel &zoom = ZOOM_LEVELS[zoomLevel];
+    int spacing = zoom.tileSize > 0 ? qRound(zoom.pitch) - zoom.tileSize : 0;
+    return {qCeil(board.getWidth() * zoom.pitch) - spacing, qCeil(board.getHeight() * zoom.pitch) - spacing};
+}
+
+/**
+ * @function zoomAround
+ * @brief Zooms to a level, keeping the board position under a point of the viewport in place.
+ *
+ * @param level The zoom level, clamped to the levels the board fits in.
+ * @param anchor The point of the viewport that stays over the same part of the board.
+ */
+void BoardView::zoomAround(int level, QPoint anchor) {
+    level = std::clamp(level, 0, getMaxZoomLevel());
+    if (level == zoomLevel) {
+        return;
+    }
+
+    // The anchor in board coordinates, where a cell is one unit
+    qreal oldPitch = ZOOM_LEVELS[zoomLevel].pitch;
+    qreal boardX = (horizontalScrollBar()->value() + anchor.x()) / oldPitch;
+    qreal boardY = (verticalScrollBar()->value() + anchor.y()) / oldPitch;
+
+    zoomLevel = level;
+    updateScrollBars();
+
+    qreal pitch = ZOOM_LEVELS[zoomLevel].pitch;
+    horizontalScrollBar()->setValue(qRound(boardX * pitch) - anchor.x());
+    verticalScrollBar()->setValue(qRound(boardY * pitch) - anchor.y());
+    viewport()->update();
+}
+
+/**
+ * @function getMaxZoomLevel
+ * @brief Returns the closest zoom level at which the whole board still fits in the pixel coordinates.
+ *
+ * Scroll positions and cell rectangles are ints, so a board whose longest side times the pitch of a
+ * level would not fit in one cannot be shown at that level. The farthest level always fits a board
+ * of BoardConfig::MAX_CELLS cells.
+ *
+ * @return The zoom level.
+ */
+int BoardView::getMaxZoomLevel() const {
+    int longestSide = std::max(board.getWidth(), board.getHeight());
+    int level = ZOOM_LEVEL_COUNT - 1;
+    while (level > 0 && longestSide * ZOOM_LEVELS[level].pitch > MAX_CONTENT_SIZE) {
+        level--;
+    }
+    return level;
+}
+
+/**
+ * @function spriteAt
+ * @brief Chooses the sprite that shows the current state of a cell.
+ *
+ * Hidden and deferred cells show their mark. Revealed mines show the exploded bomb if the player
+ * stepped on them and the unexploded bomb otherwise, and revealed safe cells show the number of
+ * adjacent mines.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The sprite to draw for the cell.
+ */
+Sprite BoardView::spriteAt(int x, int y) const {
+    if (!board.isRevealed(x, y) || (deferredCount > 0 && deferredCells[y * board.getWidth() + x])) {
+        switch (board.getMark(x, y)) {
+            case Board::Mark::FLAGGED:
+                return SPRITE_FLAG;
+            case Board::Mark::QUESTIONED:
+                return SPRITE_QUESTION;
+            default:
+                return SPRITE_HIDDEN;
+        }
+    }
+
+    if (board.isMine(x, y)) {
+        return board.isExploded(x, y) ? SPRITE_BOMB_EXPLODED : SPRITE_BOMB;
+    }
+
+    return static_cast<Sprite>(SPRITE_ZERO + board.getAdjacentMines(x, y));
+}
+
+/**
+ * @function cellAt
+ * @brief Returns the cell under a point of the viewport.
+ *
+ * @param position The point in viewport coordinates.
+ * @return The coordinates of the cell, which may lie outside the board.
+ */
+QPoint BoardView::cellAt(QPoint position) const {
+    qreal pitch = ZOOM_LEVELS[zoomLevel].pitch;
+    return {qFloor((horizontalScrollBar()->value() + position.x()) / pitch),
+            qFloor((verticalScrollBar()->value() + position.y()) / pitch)};
+}
+
+/**
+ * @function showHint
+ * @brief Highlights a cell the player can safely reveal, scrolling it into view.
+ *
+ * The highlight stays until the next move.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ */
+void BoardView::showHint(int x, int y) {
+    clearHint();
+    ensureCellVisible(x, y);
+    hintCell = y * board.getWidth() + x;
+    viewport()->update(hintRect());
+}
+
+/**
+ * @function hintRect
+ * @brief Returns the viewport rectangle of the hint highlight.
+ *
+ * @return The rectangle of the hinted cell, grown around its centre to at least MIN_HINT_SIZE.
+ */
+QRect BoardView::hintRect() const {
+    QRect rect = cellRect(hintCell % board.getWidth(), hintCell / board.getWidth());
+    if (rect.width() >= MIN_HINT_SIZE) {
+        return rect;
+    }
+
+    QRect grown(0, 0, MIN_HINT_SIZE, MIN_HINT_SIZE);
+    grown.moveCenter(rect.center());
+    return grown;
+}
+
+/**
+ * @function clearHint
+ * @brief Removes the hint highlight, if any.
+ */
+void BoardView::clearHint() {
+    if (hintCell < 0) {
+        return;
+    }
+
+    viewport()->update(hintRect());
+    hintCell = -1;
+}
+
+/**
+ * @function setProbabilities
+ * @brief Shows or hides the probability overlay.
+ *
+ * Every hidden, unmarked cell is tinted from green (certainly safe) to red (certainly a mine) and
+ * labelled with its probability in percent. The overlay is only drawn at the zoom levels that
+ * show sprites. The probabilities change all over the board after a move, so the whole viewport
+ * is repainted. The list is shared with the sender rather than copied, and one that does not
+ * match the size of the board is not drawn.
+ *
+ * @param probabilities The probability of every cell being a mine, indexed like the board, or null
+ *                      to hide the overlay.
+ */
+void BoardView::setProbabilities(std::shared_ptr<const std::vector<double>> probabilities) {
+    this->probabilities = std::move(probabilities);
+    viewport()->update();
+}
+
+/**
+ * @function paintSprites
+ * @brief Paints the cells that intersect the dirty rectangle as sprites, with the probability overlay.
+ *
+ * @param painter The painter of the current paint event.
+ * @param dirty The rectangle to repaint, in viewport coordinates.
+ */
+void BoardView::paintSprites(QPainter &painter, const QRect &dirty) {
+    const ZoomLevel &zoom = ZOOM_LEVELS[zoomLevel];
+    if (!qFuzzyCompare(atlasPixelRatio, devicePixelRatioF()) || atlasTileSize != zoom.tileSize) {
+        buildAtlas();
+    }
+
+    // Sprite levels have a whole number of pixels between cells
+    int pitch = qRound(zoom.pitch);
+    int scrollX = horizontalScrollBar()->value();
+    int scrollY = verticalScrollBar()->value();
+    int firstX = std::max(0, (dirty.left() + scrollX) / pitch);
+    int lastX = std::min(board.getWidth() - 1, (dirty.right() + scrollX) / pitch);
+    int firstY = std::max(0, (dirty.top() + scrollY) / pitch);
+    int lastY = std::min(board.getHeight() - 1, (dirty.bottom() + scrollY) / pitch);
+
+    // The atlas is in device pixels, so the source rectangles are too
+    int spritePixels = qRound(atlasTileSize * atlasPixelRatio);
+
+    for (int y = firstY; y <= lastY; y++) {
+        for (int x = firstX; x <= lastX; x++) {
+            QRect source(spriteAt(x, y) * spritePixels, 0, spritePixels, spritePixels);
+            painter.drawPixmap(cellRect(x, y), atlas, source);
+        }
+    }
+
+    if (probabilities && probabilities->size() == static_cast<std::size_t>(board.getWidth()) * board.getHeight()) {
+        for (int y = firstY; y <= lastY; y++) {
+            for (int x = firstX; x <= lastX; x++) {
+                paintProbability(painter, x, y);
+            }
+        }
+    }
+}
+
+/**
+ * @function paintBlocks
+ * @brief Paints the cells that intersect the dirty rectangle as blended colours.
+ *
+ * The dirty area is rendered into an image with one pixel per cell, or per square block of cells
+ * when cells are smaller than a pixel, which is then scaled onto the viewport. A block is the
+ * average colour of at most BLEND_SAMPLES by BLEND_SAMPLES cells spread evenly over it, so a frame
+ * costs the same however many cells it covers.
+ *
+ * @param painter The painter of the current paint event.
+ * @param dirty The rectangle to repaint, in viewport coordinates.
+ */
+void BoardView::paintBlocks(QPainter &painter, const QRect &dirty) const {
+    static const QRgb colours[SPRITE_COUNT] = {
+            qRgb(232, 232, 232), // Revealed cells get darker and more saturated as their count grows
+            qRgb(214, 220, 236),
+            qRgb(200, 216, 200),
+            qRgb(224, 196, 196),
+            qRgb(192, 196, 220),
+            qRgb(216, 184, 184),
+            qRgb(184, 212, 212),
+            qRgb(176, 176, 176),
+            qRgb(160, 160, 160),
+            qRgb(138, 143, 153), // Hidden
+            qRgb(217, 74, 56), // Flag
+            qRgb(217, 176, 56), // Question mark
+            qRgb(32, 32, 32), // Bomb
+            qRgb(255, 32, 32) // Exploded bomb
+    };
+
+    const ZoomLevel &zoom = ZOOM_LEVELS[zoomLevel];
+    int pixelsPerBlock = std::max(1, qRound(zoom.pitch));
+    int cellsPerBlock = std::max(1, qRound(1 / zoom.pitch));
+    int blocksWide = (board.getWidth() + cellsPerBlock - 1) / cellsPerBlock;
+    int blocksHigh = (board.getHeight() + cellsPerBlock - 1) / cellsPerBlock;
+
+    int scrollX = horizontalScrollBar()->value();
+    int scrollY = verticalScrollBar()->value();
+    int firstX = std::max(0, (dirty.left() + scrollX) / pixelsPerBlock);
+    int lastX = std::min(blocksWide - 1, (dirty.right() + scrollX) / pixelsPerBlock);
+    int firstY = std::max(0, (dirty.top() + scrollY) / pixelsPerBlock);
+    int lastY = std::min(blocksHigh - 1, (dirty.bottom() + scrollY) / pixelsPerBlock);
+    if (firstX > lastX || firstY > lastY) {
+        return;
+    }
+
+    int samples = std::min(cellsPerBlock, BLEND_SAMPLES);
+    int sampleStep = cellsPerBlock / samples;
+    QImage image(lastX - firstX + 1, lastY - firstY + 1, QImage::Format_RGB32);
+
+    for (int blockY = firstY; blockY <= lastY; blockY++) {
+        auto *line = reinterpret_cast<QRgb *>(image.scanLine(blockY - firstY));
+
+        for (int blockX = firstX; blockX <= lastX; blockX++) {
+            int red = 0, green = 0, blue = 0, count = 0;
+
+            // The first sample of a block is always on the board, so count is never zero
+            for (int sampleY = 0; sampleY < samples; sampleY++) {
+                int y = blockY * cellsPerBlock + sampleY * sampleStep;
+                if (y >= board.getHeight()) {
+                    break;
+                }
+                for (int sampleX = 0; sampleX < samples; sampleX++) {
+                    int x = blockX * cellsPerBlock + sampleX * sampleStep;
+                    if (x >= board.getWidth()) {
+                        break;
+                    }
+                    QRgb colour = colours[spriteAt(x, y)];
+                    red += qRed(colour);
+                    green += qGreen(colour);
+                    blue += qBlue(colour);
+                    count++;
+                }
+            }
+            line[blockX - firstX] = qRgb(red / count, green / count, blue / count);
+        }
+    }
+
+    painter.drawImage(QRect(firstX * pixelsPerBlock - scrollX, firstY * pixelsPerBlock - scrollY,
+                            image.width() * pixelsPerBlock, image.height() * pixelsPerBlock), image);
+}
+
+/**
+ * @function paintProbability
+ * @brief Paints the probability overlay of a single cell, if it is hidden and unmarked.
+ *
+ * @param painter The painter of the current paint event.
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ */
+void BoardView::paintProbability(QPainter &painter, int x, int y) const {
+    double probability = (*probabilities)[static_cast<std::size_t>(y) * board.getWidth() + x];
+    if (probability < 0 || board.isRevealed(x, y) || board.getMark(x, y) != Board::Mark::NONE) {
+        return;
+    }
+
+    QRect rect = cellRect(x, y);
+    painter.fillRect(rect, QColor::fromRgbF(static_cast<float>(probability), static_cast<float>(1 - probability),
+                                            0.0f, 0.45f));
+
+    QFont font = painter.font();
+    font.setPixelSize(std::max(1, rect.height() / 3));
+    painter.setFont(font);
+    painter.setPen(Qt::black);
+    painter.drawText(rect, Qt::AlignCenter, QString::number(qRound(probability * 100)));
+}
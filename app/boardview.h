@@ -0,0 +1,135 @@
+/**
+ * @file boardview.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the BoardView class, a scrollable and zoomable view of the Minesweeper grid.
+ *
+ * BoardView is a scroll area whose viewport paints only the cells it shows, so the cost of a frame
+ * and the memory of the view depend on the size of the window, not of the board. At the usual zoom
+ * levels every cell is a sprite copied out of an atlas that is built once per tile size. Zoomed far
+ * out, cells are smaller than a sprite can be drawn, and the view switches to a level of detail
+ * where every pixel is a colour blended from the cells it covers. Clicks are mapped to cells from
+ * the mouse coordinates and forwarded as requests, and after a move only the rectangle covering
+ * the changed cells is repainted. Cells of a move that reach the view in slices can be deferred, so
+ * they stay hidden until their slice is shown.
+ */
+
+#ifndef QT_MINESWEEPER_BOARDVIEW_H
+#define QT_MINESWEEPER_BOARDVIEW_H
+
+#include <QAbstractScrollArea>
+#include <QPixmap>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPaintEvent>
+#include <QWheelEvent>
+#include <memory>
+#include <vector>
+#include "board.h"
+#include "sprites.h"
+
+class BoardView : public QAbstractScrollArea {
+Q_OBJECT
+
+public:
+
+    explicit BoardView(const Board &board, QWidget *parent = nullptr);
+
+    ~BoardView() override;
+
+    BoardView(const BoardView &) = delete;
+
+    BoardView &operator=(const BoardView &) = delete;
+
+    BoardView(BoardView &&) = delete;
+
+    BoardView &operator=(BoardView &&) = delete;
+
+    QSize sizeHint() const override;
+
+    QRect cellRect(int x, int y) const;
+
+    void ensureCellVisible(int x, int y);
+
+    int getZoomLevel() const;
+
+    void setZoomLevel(int level);
+
+    bool isDetailed() const;
+
+signals:
+
+    void revealRequested(int x, int y);
+
+    void markRequested(int x, int y);
+
+    void chordRequested(int x, int y);
+
+public slots:
+
+    void updateCells(const std::vector<int> &cells);
+
+    void updateAll();
+
+    void deferCells(const std::vector<int> &cells);
+
+    void showHint(int x, int y);
+
+    void setProbabilities(std::shared_ptr<const std::vector<double>> probabilities);
+
+    void zoomIn();
+
+    void zoomOut();
+
+    void resetZoom();
+
+protected:
+
+    void paintEvent(QPaintEvent *event) override;
+
+    void mousePressEvent(QMouseEvent *event) override;
+
+    void wheelEvent(QWheelEvent *event) override;
+
+    void resizeEvent(QResizeEvent *event) override;
+
+    void scrollContentsBy(int dx, int dy) override;
+
+private:
+
+    void buildAtlas();
+
+    void updateScrollBars();
+
+    QSize contentSize() const;
+
+    void zoomAround(int level, QPoint anchor);
+
+    int getMaxZoomLevel() const;
+
+    Sprite spriteAt(int x, int y) const;
+
+    QPoint cellAt(QPoint position) const;
+
+    QRect hintRect() const;
+
+    void clearHint();
+
+    void paintSprites(QPainter &painter, const QRect &dirty);
+
+    void paintBlocks(QPainter &painter, const QRect &dirty) const;
+
+    void paintProbability(QPainter &painter, int x, int y) const;
+
+    const Board &board;
+    QPixmap atlas;
+    qreal atlasPixelRatio;
+    int atlasTileSize; // Tile size the atlas was built for
+    int zoomLevel; // Index into the table of zoom levels
+    int hintCell; // Board index of the highlighted hint, -1 if there is none
+    std::shared_ptr<const std::vector<double>> probabilities; // Mine probability per cell, null when the overlay is off
+    std::vector<bool> deferredCells; // Cells still drawn as hidden until their update arrives
+    int deferredCount; // Cells set in deferredCells
+};
+
+#endif //QT_MINESWEEPER_BOARDVIEW_H
@@ -0,0 +1,156 @@
+/**
+ * @file builtinstrategies.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the built-in strategies.
+ */
+
+#include "builtinstrategies.h"
+
+namespace {
+
+// The centre cell, where every built-in strategy opens the board
+Action openCentre(const PlayerView &view) {
+    return {Action::Type::REVEAL, view.getWidth() / 2, view.getHeight() / 2};
+}
+
+// A random hidden cell that the filter accepts; a running game always has one
+template<typename Filter>
+Action revealRandomCell(const PlayerView &view, Random &random, Filter accept) {
+    int width = view.getWidth();
+    int cellCount = width * view.getHeight();
+    int cell;
+    do {
+        cell = static_cast<int>(random.nextBelow(cellCount));
+    } while (view.isRevealed(cell % width, cell / width) || !accept(cell));
+    return {Action::Type::REVEAL, cell % width, cell / width};
+}
+
+}
+
+/**
+ * @function RandomStrategy
+ * @brief Constructs a RandomStrategy.
+ */
+RandomStrategy::RandomStrategy() : random(0) {}
+
+/**
+ * @function getName
+ * @brief Returns the name of the strategy.
+ *
+ * @return "random".
+ */
+const char *RandomStrategy::getName() const {
+    return "random";
+}
+
+/**
+ * @function newGame
+ * @brief Starts a new game.
+ *
+ * @param view The view of the board.
+ * @param seed The seed of the random moves.
+ */
+void RandomStrategy::newGame(PlayerView view, std::uint64_t seed) {
+    this->view.emplace(view);
+    random = Random(seed);
+}
+
+/**
+ * @function nextAction
+ * @brief Reveals a random hidden cell.
+ *
+ * @param changedCells Not used.
+ * @return The action.
+ */
+Action RandomStrategy::nextAction([[maybe_unused]] std::span<const int> changedCells) {
+    if (view->isOpeningPending()) {
+        return openCentre(*view);
+    }
+    return revealRandomCell(*view, random, [](int) { return true; });
+}
+
+/**
+ * @function SolverStrategy
+ * @brief Constructs a SolverStrategy.
+ */
+SolverStrategy::SolverStrategy() : random(0) {}
+
+/**
+ * @function getName
+ * @brief Returns the name of the strategy.
+ *
+ * @return "solver".
+ */
+const char *SolverStrategy::getName() const {
+    return "solver";
+}
+
+/**
+ * @function newGame
+ * @brief Starts a new game and sets up the solver on its board.
+ *
+ * @param view The view of the board.
+ * @param seed The seed of the random guesses.
+ */
+void SolverStrategy::newGame(PlayerView view, std::uint64_t seed) {
+    this->view.emplace(view);
+    solver.emplace(view);
+    random = Random(seed);
+}
+
+/**
+ * @function nextAction
+ * @brief Reveals a cell the solver proved safe, or guesses if there is none.
+ *
+ * @param changedCells The cells revealed by the previous action, which are fed to the solver.
+ * @return The action.
+ */
+Action SolverStrategy::nextAction(std::span<const int> changedCells) {
+    solver->update(changedCells);
+
+    if (view->isOpeningPending()) {
+        return openCentre(*view);
+    }
+
+    int cell = solver->findSafeCell();
+    if (cell < 0) {
+        cell = guess();
+    }
+    return {Action::Type::REVEAL, cell % view->getWidth(), cell / view->getWidth()};
+}
+
+/**
+ * @function guess
+ * @brief Picks a random hidden cell that the solver has not proven to be a mine.
+ *
+ * @return The board index of the cell.
+ */
+int SolverStrategy::guess() {
+    int width = view->getWidth();
+    Action action = revealRandomCell(*view, random, [this, width](int cell) {
+        return !solver->isKnownMine(cell % width, cell / width);
+    });
+    return action.y * width + action.x;
+}
+
+/**
+ * @function getName
+ * @brief Returns the name of the strategy.
+ *
+ * @return "probability".
+ */
+const char *ProbabilityStrategy::getName() const {
+    return "probability";
+}
+
+/**
+ * @function guess
+ * @brief Picks the hidden cell that is least likely to be a mine.
+ *
+ * @return The board index of the cell.
+ */
+int ProbabilityStrategy::guess() {
+    engine.compute(*view);
+    return engine.findBestGuess();
+}
@@ -0,0 +1,72 @@
+/**
+ * @file builtinstrategies.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the strategies that come with the game.
+ *
+ * RandomStrategy is the baseline. SolverStrategy plays every move the Solver proves safe and
+ * guesses at random otherwise; ProbabilityStrategy plays the same safe moves but guesses the cell
+ * the ProbabilityEngine finds least likely to be a mine. All of them open the board in the centre.
+ */
+
+#ifndef QT_MINESWEEPER_BUILTINSTRATEGIES_H
+#define QT_MINESWEEPER_BUILTINSTRATEGIES_H
+
+#include <optional>
+#include "probabilityengine.h"
+#include "random.h"
+#include "solver.h"
+#include "strategy.h"
+
+class RandomStrategy : public Strategy {
+public:
+
+    RandomStrategy();
+
+    const char *getName() const override;
+
+    void newGame(PlayerView view, std::uint64_t seed) override;
+
+    Action nextAction(std::span<const int> changedCells) override;
+
+private:
+
+    std::optional<PlayerView> view;
+    Random random;
+};
+
+class SolverStrategy : public Strategy {
+public:
+
+    SolverStrategy();
+
+    const char *getName() const override;
+
+    void newGame(PlayerView view, std::uint64_t seed) override;
+
+    Action nextAction(std::span<const int> changedCells) override;
+
+protected:
+
+    virtual int guess();
+
+    std::optional<PlayerView> view;
+    std::optional<Solver> solver;
+    Random random;
+};
+
+class ProbabilityStrategy : public SolverStrategy {
+public:
+
+    const char *getName() const override;
+
+protected:
+
+    int guess() override;
+
+private:
+
+    ProbabilityEngine engine;
+};
+
+#endif //QT_MINESWEEPER_BUILTINSTRATEGIES_H
@@ -14,4 +14,13 @@ constexpr int GRID_WIDTH = 30; // Number of tiles in a row
 constexpr int GRID_HEIGHT = 16; // Number of tiles in a column
 constexpr int NUMBER_OF_MINES = 99;
 
+constexpr int TILE_SIZE = 30; // Width and height of a tile in pixels
+constexpr int TILE_SPACING = 1; // Gap between two tiles in pixels
+
+constexpr int PREFETCHED_BOARDS = 2; // Boards generated in the background ahead of the next games
+
+constexpr int REVEAL_SLICE = 4096; // Cells of a move handed to the solver and the view at a time
+constexpr int REVEAL_ANIMATION_FRAMES = 20; // Frames an animated reveal is spread over
+constexpr int MIN_REVEAL_ANIMATION_STEP = 4; // Fewest cells an animated reveal shows per frame
+
 #endif //QT_MINESWEEPER_CONSTANTS_H
@@ -0,0 +1,370 @@
+/**
+ * @file endlessview.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the EndlessView class, which paints the visible part of an endless board
+ *        and turns drags into panning and clicks into reveal and mark requests.
+ */
+
+#include <algorithm>
+#include <QApplication>
+#include <QPainter>
+#include "constants.h"
+#include "endlessview.h"
+#include "pixmapcache.h"
+#include "trace.h"
+
+namespace {
+
+constexpr int PITCH = TILE_SIZE + TILE_SPACING; // Distance between the origins of two cells in pixels
+constexpr int WHEEL_CELLS = 3; // Cells scrolled per notch of a mouse wheel
+
+// Rounds towards negative infinity, so cells left of and above the origin get negative coordinates
+std::int64_t floorDivide(std::int64_t value, std::int64_t divisor) {
+    std::int64_t quotient = value / divisor;
+    return quotient - (value % divisor < 0);
+}
+
+}
+
+/**
+ * @function EndlessView
+ * @brief Constructs an EndlessView with cell (0, 0) in the middle.
+ *
+ * @param board The board to show. It must stay alive until it is replaced with setBoard().
+ * @param parent The parent widget.
+ */
+EndlessView::EndlessView(const InfiniteBoard *board, QWidget *parent)
+        : QWidget(parent), board(board), spritePixelRatio(0), centreX(TILE_SIZE / 2), centreY(TILE_SIZE / 2),
+          dragging(false) {
+    setAttribute(Qt::WA_OpaquePaintEvent);
+}
+
+/**
+ * @function ~EndlessView
+ * @brief Destructor for EndlessView.
+ *
+ * The board is owned by the caller, so there is nothing to clean up explicitly.
+ */
+EndlessView::~EndlessView() = default;
+
+/**
+ * @function sizeHint
+ * @brief Returns the size of an expert board, which the view starts at.
+ *
+ * @return The preferred size of the view.
+ */
+QSize EndlessView::sizeHint() const {
+    return {GRID_WIDTH * PITCH - TILE_SPACING, GRID_HEIGHT * PITCH - TILE_SPACING};
+}
+
+/**
+ * @function setBoard
+ * @brief Shows another board, such as the one of a new game, at the current position.
+ *
+ * @param board The board to show. It must stay alive until it is replaced.
+ */
+void EndlessView::setBoard(const InfiniteBoard *board) {
+    this->board = board;
+    announceVisibleCells();
+    update();
+}
+
+/**
+ * @function cellRect
+ * @brief Returns the widget rectangle a cell is drawn in.
+ *
+ * Only meaningful for cells near the widget; the coordinates of cells far away do not fit in a
+ * rectangle.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The rectangle of the cell in widget coordinates, which may lie outside the widget.
+ */
+QRect EndlessView::cellRect(std::int64_t x, std::int64_t y) const {
+    return {static_cast<int>(x * PITCH - originX()), static_cast<int>(y * PITCH - originY()), TILE_SIZE, TILE_SIZE};
+}
+
+/**
+ * @function centreOn
+ * @brief Scrolls a cell into the middle of the widget.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ */
+void EndlessView::centreOn(std::int64_t x, std::int64_t y) {
+    centreX = x * PITCH + TILE_SIZE / 2;
+    centreY = y * PITCH + TILE_SIZE / 2;
+    announceVisibleCells();
+    update();
+}
+
+/**
+ * @function updateCells
+ * @brief Schedules a repaint of a batch of changed cells.
+ *
+ * Only the part of the bounding rectangle of the batch that lies inside the widget is invalidated,
+ * so an opening that runs far off screen costs no more than the cells it shows.
+ *
+ * @param cells The coordinates of the cells that changed.
+ */
+void EndlessView::updateCells(const std::vector<InfiniteBoard::Cell> &cells) {
+    if (cells.empty()) {
+        return;
+    }
+
+    std::int64_t minX = cells.front().x, maxX = minX, minY = cells.front().y, maxY = minY;
+    for (const InfiniteBoard::Cell &cell: cells) {
+        minX = std::min(minX, cell.x);
+        maxX = std::max(maxX, cell.x);
+        minY = std::min(minY, cell.y);
+        maxY = std::max(maxY, cell.y);
+    }
+
+    // Clamp to the visible cells before converting to pixels, so the rectangle cannot overflow
+    std::int64_t firstVisibleX = floorDivide(originX(), PITCH);
+    std::int64_t firstVisibleY = floorDivide(originY(), PITCH);
+    minX = std::max(minX, firstVisibleX);
+    maxX = std::min(maxX, firstVisibleX + width() / PITCH + 1);
+    minY = std::max(minY, firstVisibleY);
+    maxY = std::min(maxY, firstVisibleY + height() / PITCH + 1);
+    if (minX > maxX || minY > maxY) {
+        return;
+    }
+
+    update(cellRect(minX, minY).united(cellRect(maxX, maxY)));
+}
+
+/**
+ * @function paintEvent
+ * @brief Paints the cells that intersect the dirty rectangle of the widget.
+ *
+ * @param event The QPaintEvent object containing the rectangle to repaint.
+ */
+void EndlessView::paintEvent(QPaintEvent *event) {
+    TRACE_SCOPE("EndlessView::paintEvent");
+    if (!qFuzzyCompare(spritePixelRatio, devicePixelRatioF())) {
+        loadSprites();
+    }
+
+    QPainter painter(this);
+    QRect dirty = event->rect();
+    painter.fillRect(dirty, palette().window());
+
+    std::int64_t firstX = floorDivide(originX() + dirty.left(), PITCH);
+    std::int64_t lastX = floorDivide(originX() + dirty.right(), PITCH);
+    std::int64_t firstY = floorDivide(originY() + dirty.top(), PITCH);
+    std::int64_t lastY = floorDivide(originY() + dirty.bottom(), PITCH);
+
+    for (std::int64_t y = firstY; y <= lastY; y++) {
+        for (std::int64_t x = firstX; x <= lastX; x++) {
+            painter.drawPixmap(cellRect(x, y), sprites[spriteAt(x, y)]);
+        }
+    }
+}
+
+/**
+ * @function mousePressEvent
+ * @brief Handles the mouse press event.
+ *
+ * The right button requests a mark change for the cell under the pointer. The left button starts
+ * either a click or a drag, which mouseReleaseEvent() and mouseMoveEvent() tell apart.
+ *
+ * @param event The QMouseEvent object containing details about the mouse event.
+ */
+void EndlessView::mousePressEvent(QMouseEvent *event) {
+    QPoint position = event->position().toPoint();
+
+    if (event->button() == Qt::LeftButton) {
+        pressPosition = position;
+        lastDragPosition = position;
+        dragging = false;
+    } else if (event->button() == Qt::RightButton) {
+        InfiniteBoard::Cell cell = cellAt(position);
+        if (cellRect(cell.x, cell.y).contains(position)) {
+            emit markRequested(cell.x, cell.y);
+        }
+    }
+}
+
+/**
+ * @function mouseMoveEvent
+ * @brief Pans the board while the left button is held, once the pointer has moved far enough.
+ *
+ * @param event The QMouseEvent object containing details about the mouse event.
+ */
+void EndlessView::mouseMoveEvent(QMouseEvent *event) {
+    if (!(event->buttons() & Qt::LeftButton)) {
+        return;
+    }
+
+    QPoint position = event->position().toPoint();
+    if (!dragging && (position - pressPosition).manhattanLength() >= QApplication::startDragDistance()) {
+        dragging = true;
+        setCursor(Qt::ClosedHandCursor);
+    }
+    if (dragging) {
+        QPoint delta = position - lastDragPosition;
+        lastDragPosition = position;
+        pan(delta.x(), delta.y());
+    }
+}
+
+/**
+ * @function mouseReleaseEvent
+ * @brief Requests a reveal of the cell under the pointer, unless the left button was dragging.
+ *
+ * Releases on the spacing between tiles are ignored.
+ *
+ * @param event The QMouseEvent object containing details about the mouse event.
+ */
+void EndlessView::mouseReleaseEvent(QMouseEvent *event) {
+    if (event->button() != Qt::LeftButton) {
+        return;
+    }
+
+    if (dragging) {
+        dragging = false;
+        unsetCursor();
+        return;
+    }
+
+    QPoint position = event->position().toPoint();
+    InfiniteBoard::Cell cell = cellAt(position);
+    if (cellRect(cell.x, cell.y).contains(position)) {
+        emit revealRequested(cell.x, cell.y);
+    }
+}
+
+/**
+ * @function wheelEvent
+ * @brief Pans the board, by the pixels of a touchpad or by WHEEL_CELLS cells per wheel notch.
+ *
+ * @param event The QWheelEvent object containing details about the wheel event.
+ */
+void EndlessView::wheelEvent(QWheelEvent *event) {
+    QPoint delta = event->pixelDelta();
+    if (delta.isNull()) {
+        delta = event->angleDelta() * WHEEL_CELLS * PITCH / 120; // A notch is 120 eighths of a degree
+    }
+    pan(delta.x(), delta.y());
+    event->accept();
+}
+
+/**
+ * @function resizeEvent
+ * @brief Prefetches the cells that came into view. The position is kept in the middle of the
+ *        widget, so the board stays centred on the same cell.
+ *
+ * @param event The QResizeEvent object containing the old and new sizes.
+ */
+void EndlessView::resizeEvent(QResizeEvent *event) {
+    QWidget::resizeEvent(event);
+    announceVisibleCells();
+}
+
+/**
+ * @function loadSprites
+ * @brief Takes every sprite from the shared PixmapCache, scaled for the current device pixel ratio.
+ */
+void EndlessView::loadSprites() {
+    spritePixelRatio = devicePixelRatioF();
+    for (int sprite = 0; sprite < SPRITE_COUNT; sprite++) {
+        sprites[sprite] = PixmapCache::instance().pixmap(SPRITE_PATHS[sprite], TILE_SIZE, spritePixelRatio);
+    }
+}
+
+/**
+ * @function pan
+ * @brief Moves the board under the widget.
+ *
+ * The pixels that stay visible are moved rather than painted again, and the cells that come into
+ * view are prefetched before the strips they are in get painted.
+ *
+ * @param dx The distance to move the board to the right, in pixels.
+ * @param dy The distance to move the board down, in pixels.
+ */
+void EndlessView::pan(int dx, int dy) {
+    if (dx == 0 && dy == 0) {
+        return;
+    }
+
+    centreX -= dx;
+    centreY -= dy;
+    announceVisibleCells();
+    scroll(dx, dy);
+}
+
+/**
+ * @function announceVisibleCells
+ * @brief Emits visibleCellsChanged() with the cells inside the widget and a ring of one cell around
+ *        them, whose counts decide the cells at the edge.
+ */
+void EndlessView::announceVisibleCells() {
+    std::int64_t minX = floorDivide(originX(), PITCH) - 1;
+    std::int64_t minY = floorDivide(originY(), PITCH) - 1;
+    std::int64_t maxX = floorDivide(originX() + std::max(0, width() - 1), PITCH) + 1;
+    std::int64_t maxY = floorDivide(originY() + std::max(0, height() - 1), PITCH) + 1;
+    emit visibleCellsChanged(minX, minY, maxX, maxY);
+}
+
+/**
+ * @function spriteAt
+ * @brief Chooses the sprite that shows the current state of a cell.
+ *
+ * Hidden cells show their mark. The only mine that can be revealed is the one that ended the game,
+ * which shows the exploded bomb, and revealed safe cells show the number of adjacent mines.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The sprite to draw for the cell.
+ */
+Sprite EndlessView::spriteAt(std::int64_t x, std::int64_t y) const {
+    if (!board->isRevealed(x, y)) {
+        switch (board->getMark(x, y)) {
+            case Board::Mark::FLAGGED:
+                return SPRITE_FLAG;
+            case Board::Mark::QUESTIONED:
+                return SPRITE_QUESTION;
+            default:
+                return SPRITE_HIDDEN;
+        }
+    }
+
+    if (board->isMine(x, y)) {
+        return SPRITE_BOMB_EXPLODED;
+    }
+
+    return static_cast<Sprite>(SPRITE_ZERO + board->getAdjacentMines(x, y));
+}
+
+/**
+ * @function cellAt
+ * @brief Returns the cell under a point of the widget.
+ *
+ * @param position The point in widget coordinates.
+ * @return The coordinates of the cell.
+ */
+InfiniteBoard::Cell EndlessView::cellAt(QPoint position) const {
+    return {floorDivide(originX() + position.x(), PITCH), floorDivide(originY() + position.y(), PITCH)};
+}
+
+/**
+ * @function originX
+ * @brief Returns the board pixel at the left edge of the widget.
+ *
+ * @return The x-coordinate in board pixels, where cell (0, 0) starts at 0.
+ */
+std::int64_t EndlessView::originX() const {
+    return centreX - width() / 2;
+}
+
+/**
+ * @function originY
+ * @brief Returns the board pixel at the top edge of the widget.
+ *
+ * @return The y-coordinate in board pixels, where cell (0, 0) starts at 0.
+ */
+std::int64_t EndlessView::originY() const {
+    return centreY - height() / 2;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file endlessview.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the EndlessView class, a pannable view of an InfiniteBoard.
+ *
+ * An endless board has no size, so the view has no scroll bars: its position is the board pixel in
+ * the middle of the widget, which the player moves by dragging with the left button or with the
+ * mouse wheel, and which a resize keeps in place. Only the cells inside the widget are painted, and
+ * every time the visible area changes the view asks for its cells to be prefetched, so the chunks
+ * under the viewport are materialized before they are painted or played. Clicks are mapped to
+ * cells and forwarded as requests, like in BoardView.
+ */
+
+#ifndef QT_MINESWEEPER_ENDLESSVIEW_H
+#define QT_MINESWEEPER_ENDLESSVIEW_H
+
+#include <QMouseEvent>
+#include <QPaintEvent>
+#include <QPixmap>
+#include <QWheelEvent>
+#include <QWidget>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "infiniteboard.h"
+#include "sprites.h"
+
+class EndlessView : public QWidget {
+Q_OBJECT
+
+public:
+
+    explicit EndlessView(const InfiniteBoard *board, QWidget *parent = nullptr);
+
+    ~EndlessView() override;
+
+    EndlessView(const EndlessView &) = delete;
+
+    EndlessView &operator=(const EndlessView &) = delete;
+
+    EndlessView(EndlessView &&) = delete;
+
+    EndlessView &operator=(EndlessView &&) = delete;
+
+    QSize sizeHint() const override;
+
+    void setBoard(const InfiniteBoard *board);
+
+    QRect cellRect(std::int64_t x, std::int64_t y) const;
+
+    void centreOn(std::int64_t x, std::int64_t y);
+
+signals:
+
+    void revealRequested(qint64 x, qint64 y);
+
+    void markRequested(qint64 x, qint64 y);
+
+    void visibleCellsChanged(qint64 minX, qint64 minY, qint64 maxX, qint64 maxY);
+
+public slots:
+
+    void updateCells(const std::vector<InfiniteBoard::Cell> &cells);
+
+protected:
+
+    void paintEvent(QPaintEvent *event) override;
+
+    void mousePressEvent(QMouseEvent *event) override;
+
+    void mouseMoveEvent(QMouseEvent *event) override;
+
+    void mouseReleaseEvent(QMouseEvent *event) override;
+
+    void wheelEvent(QWheelEvent *event) override;
+
+    void resizeEvent(QResizeEvent *event) override;
+
+private:
+
+    void loadSprites();
+
+    void pan(int dx, int dy);
+
+    void announceVisibleCells();
+
+    Sprite spriteAt(std::int64_t x, std::int64_t y) const;
+
+    InfiniteBoard::Cell cellAt(QPoint position) const;
+
+    std::int64_t originX() const;
+
+    std::int64_t originY() const;
+
+    const InfiniteBoard *board;
+    std::array<QPixmap, SPRITE_COUNT> sprites;
+    qreal spritePixelRatio; // Device pixel ratio the sprites were scaled for
+    std::int64_t centreX; // Board pixel in the middle of the widget; cell (0, 0) starts at board pixel 0
+    std::int64_t centreY;
+    QPoint pressPosition; // Where the left button went down, to tell a click from a drag
+    QPoint lastDragPosition;
+    bool dragging;
+};
+
+#endif //QT_MINESWEEPER_ENDLESSVIEW_H
@@ -0,0 +1,170 @@
+/**
+ * @file endlesswindow.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the EndlessWindow class, which plays an endless game on an InfiniteBoard.
+ */
+
+#include <random>
+#include <QMenuBar>
+#include <QMessageBox>
+#include <QStatusBar>
+#include "endlesswindow.h"
+#include "trace.h"
+
+/**
+ * @function EndlessWindow
+ * @brief Constructor for EndlessWindow.
+ *
+ * Sets up the view of the first board, the Game menu with the new-game and go-to-start actions,
+ * and the connections that route the requests of the view to the board.
+ *
+ * @param parent The parent widget, typically the main window.
+ */
+EndlessWindow::EndlessWindow(QWidget *parent)
+        : QMainWindow(parent),
+          seedSource((static_cast<std::uint64_t>(std::random_device{}()) << 32) | std::random_device{}()),
+          board(std::make_unique<InfiniteBoard>(seedSource.next())) {
+    setWindowTitle("Endless Minesweeper");
+
+    view = new EndlessView(board.get(), this);
+    setCentralWidget(view);
+    scoreLabel = new QLabel(this);
+    statusBar()->addPermanentWidget(scoreLabel);
+    updateStatus();
+
+    connect(view, &EndlessView::revealRequested, this, &EndlessWindow::revealCell);
+    connect(view, &EndlessView::markRequested, this, &EndlessWindow::markCell);
+    connect(view, &EndlessView::visibleCellsChanged, this, [this](qint64 minX, qint64 minY, qint64 maxX, qint64 maxY) {
+        board->prefetch(minX, minY, maxX, maxY);
+    });
+
+    QMenu *gameMenu = menuBar()->addMenu("&Game");
+    QAction *newGameAction = gameMenu->addAction("&New game");
+    newGameAction->setShortcut(QKeySequence::New);
+    QAction *startAction = gameMenu->addAction("&Go to start");
+    startAction->setShortcut(Qt::Key_Home);
+
+    connect(newGameAction, &QAction::triggered, this, &EndlessWindow::newGame);
+    connect(startAction, &QAction::triggered, this, [this]() {
+        view->centreOn(0, 0);
+    });
+}
+
+/**
+ * @function ~EndlessWindow
+ * @brief Destructor for EndlessWindow.
+ *
+ * The board is owned through a unique pointer and the view is a child widget deleted by Qt.
+ */
+EndlessWindow::~EndlessWindow() = default;
+
+/**
+ * @function getBoard
+ * @brief Gets the board of the current game.
+ *
+ * @return The board, owned by the window and replaced by every new game.
+ */
+const InfiniteBoard &EndlessWindow::getBoard() const {
+    return *board;
+}
+
+/**
+ * @function getView
+ * @brief Gets the view that draws the board.
+ *
+ * @return The EndlessView, a child widget of the window.
+ */
+EndlessView *EndlessWindow::getView() const {
+    return view;
+}
+
+/**
+ * @function newGame
+ * @brief Starts a game on a board with a new seed, centred on its mine-free origin.
+ */
+void EndlessWindow::newGame() {
+    board = std::make_unique<InfiniteBoard>(seedSource.next());
+    view->setBoard(board.get());
+    view->centreOn(0, 0);
+    updateStatus();
+}
+
+/**
+ * @function revealCell
+ * @brief Slot to handle when the player asks to reveal a cell.
+ *
+ * Only the cells of the move that are visible get repainted, however far the opening runs.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ */
+void EndlessWindow::revealCell(qint64 x, qint64 y) {
+    TRACE_SCOPE("EndlessWindow::revealCell");
+    if (board->isLost() || board->isRevealed(x, y)) {
+        return;
+    }
+
+    changedCells.clear();
+    Board::RevealResult result = board->reveal(x, y, &changedCells);
+    if (result == Board::RevealResult::IGNORED) {
+        return;
+    }
+
+    view->updateCells(changedCells);
+    updateStatus();
+    if (result == Board::RevealResult::MINE) {
+        onGameOver();
+    }
+}
+
+/**
+ * @function markCell
+ * @brief Slot to handle when the player asks to change the mark of a cell.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ */
+void EndlessWindow::markCell(qint64 x, qint64 y) {
+    if (board->isLost() || board->isRevealed(x, y)) {
+        return;
+    }
+
+    board->cycleMark(x, y);
+    changedCells.assign(1, {x, y});
+    view->updateCells(changedCells);
+}
+
+/**
+ * @function onGameOver
+ * @brief Shows the score and asks whether to play again.
+ *
+ * Like the game-over box of the main window, the box is window-modal and opened without a nested
+ * event loop. Declining closes the endless window only.
+ */
+void EndlessWindow::onGameOver() {
+    auto *msgBox = new QMessageBox(this);
+    msgBox->setAttribute(Qt::WA_DeleteOnClose);
+    msgBox->setWindowTitle("Game Over");
+    msgBox->setText(QString("Boom! You revealed %1 safe cells.").arg(board->getRevealedSafeCells()));
+    msgBox->setInformativeText("Do you want to play again?");
+    msgBox->setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+    msgBox->setDefaultButton(QMessageBox::Yes);
+
+    connect(msgBox, &QMessageBox::finished, this, [this](int ret) {
+        if (ret == QMessageBox::Yes) {
+            newGame();
+        } else {
+            close();
+        }
+    });
+    msgBox->open();
+}
+
+/**
+ * @function updateStatus
+ * @brief Shows the number of safe cells revealed so far in the status bar.
+ */
+void EndlessWindow::updateStatus() {
+    scoreLabel->setText(QString("%1 cells revealed").arg(board->getRevealedSafeCells()));
+}
@@ -0,0 +1,68 @@
+/**
+ * @file endlesswindow.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the EndlessWindow class, the window of an endless game.
+ *
+ * An endless game is played on an InfiniteBoard and shown by an EndlessView. The window owns both,
+ * applies the reveal and mark requests of the view to the board, and prefetches the cells the view
+ * reports as visible. There is no win: the game goes on until the player steps on a mine, and the
+ * score is the number of safe cells revealed.
+ */
+
+#ifndef QT_MINESWEEPER_ENDLESSWINDOW_H
+#define QT_MINESWEEPER_ENDLESSWINDOW_H
+
+#include <QLabel>
+#include <QMainWindow>
+#include <memory>
+#include <vector>
+#include "endlessview.h"
+#include "infiniteboard.h"
+#include "random.h"
+
+class EndlessWindow : public QMainWindow {
+Q_OBJECT
+
+public:
+
+    explicit EndlessWindow(QWidget *parent = nullptr);
+
+    ~EndlessWindow() override;
+
+    EndlessWindow(const EndlessWindow &) = delete;
+
+    EndlessWindow &operator=(const EndlessWindow &) = delete;
+
+    EndlessWindow(EndlessWindow &&) = delete;
+
+    EndlessWindow &operator=(EndlessWindow &&) = delete;
+
+    const InfiniteBoard &getBoard() const;
+
+    EndlessView *getView() const;
+
+public slots:
+
+    void newGame();
+
+    void revealCell(qint64 x, qint64 y);
+
+    void markCell(qint64 x, qint64 y);
+
+private slots:
+
+    void onGameOver();
+
+private:
+
+    void updateStatus();
+
+    Random seedSource; // Draws the seed of every new game
+    std::unique_ptr<InfiniteBoard> board;
+    EndlessView *view;
+    QLabel *scoreLabel;
+    std::vector<InfiniteBoard::Cell> changedCells; // Cells changed by the last move, reused across moves
+};
+
+#endif //QT_MINESWEEPER_ENDLESSWINDOW_H
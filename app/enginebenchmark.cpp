@@ -0,0 +1,331 @@
+/**
+ * @file enginebenchmark.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Entry point of the engine micro-benchmarks.
+ *
+ * Times the hot paths of the engine (mine placement, adjacency counts, the flood fill of the
+ * largest opening, win detection and the restart of the solver after a short game) on boards from
+ * beginner size up to millions of cells, at densities from 5% to 40%, whole games played by the
+ * solver on the classic sizes and the playback of their replays, and the chunks of an endless
+ * board materialized for a viewport.
+ * Every case runs on the same boards in every run. The results can be saved as a JSON baseline,
+ * and a later run can be compared against it to flag cases that became slower than a threshold, so
+ * a regression is caught before it ships.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+#include "boardconfig.h"
+#include "boardgenerator.h"
+#include "builtinstrategies.h"
+#include "gamesimulator.h"
+#include "infiniteboard.h"
+#include "replay.h"
+#include "replayengine.h"
+#include "solver.h"
+#include "threadpool.h"
+
+namespace {
+
+constexpr std::uint64_t BOARD_SEED = 0x5eed;
+constexpr int MIN_SAMPLES = 5;
+constexpr long long MAX_GAME_CELLS = 1 << 12; // Whole games are only played on boards up to this size
+constexpr int GAMES_PER_SAMPLE = 16;
+
+struct Size {
+    const char *name;
+    int width;
+    int height;
+};
+
+constexpr Size SIZES[] = {
+        {"beginner",     9,    9},
+        {"intermediate", 16,   16},
+        {"expert",       30,   16},
+        {"256x256",      256,  256},
+        {"1024x1024",    1024, 1024},
+        {"2048x2048",    2048, 2048}
+};
+
+constexpr int DENSITIES[] = {5, 12, 20, 40}; // Percent of the cells that are mines
+
+struct Result {
+    QString name;
+    long long cells;
+    double nanoseconds; // Median time of one run of the case
+    int samples;
+};
+
+// Runs setup and the timed body until minSeconds of body time and MIN_SAMPLES samples are
+// collected, and returns the median time of the body in nanoseconds
+double measure(double minSeconds, const std::function<void()> &setup, const std::function<void()> &body,
+               int &samples) {
+    std::vector<double> times;
+    double total = 0;
+
+    while (static_cast<int>(times.size()) < MIN_SAMPLES || total < minSeconds) {
+        setup();
+        auto start = std::chrono::steady_clock::now();
+        body();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        times.push_back(seconds * 1e9);
+        total += seconds;
+    }
+
+    samples = static_cast<int>(times.size());
+    std::nth_element(times.begin(), times.begin() + samples / 2, times.end());
+    return times[samples / 2];
+}
+
+// The zero cell with the largest opening, or the first safe cell if the board has no zero cell
+int findLargestOpening(const Board &board) {
+    Board scratch = board;
+    int best = -1;
+    int bestSize = 0;
+
+    for (int y = 0; y < board.getHeight(); y++) {
+        for (int x = 0; x < board.getWidth(); x++) {
+            if (board.isMine(x, y) || scratch.isRevealed(x, y)) {
+                continue;
+            }
+            if (best < 0) {
+                best = y * board.getWidth() + x;
+            }
+            if (board.getAdjacentMines(x, y) == 0) {
+                int before = scratch.getRevealedSafeCells();
+                scratch.reveal(x, y);
+                if (scratch.getRevealedSafeCells() - before > bestSize) {
+                    bestSize = scratch.getRevealedSafeCells() - before;
+                    best = y * board.getWidth() + x;
+                }
+            }
+        }
+    }
+    return best;
+}
+
+std::vector<Result> runCases(ThreadPool *pool, double minSeconds, const QString &filter) {
+    std::vector<Result> results;
+    BoardGenerator generator(pool);
+
+    auto run = [&](const QString &name, long long cells, const std::function<void()> &setup,
+                   const std::function<void()> &body) {
+        if (!filter.isEmpty() && !name.contains(filter)) {
+            return;
+        }
+        Result result{name, cells, 0, 0};
+        result.nanoseconds = measure(minSeconds, setup, body, result.samples);
+        results.push_back(result);
+    };
+
+    for (const Size &size: SIZES) {
+        for (int density: DENSITIES) {
+            BoardConfig config{size.width, size.height, 0};
+            config.mineCount = static_cast<int>(config.getCellCount() * density / 100);
+            QString suffix = QString("/%1/%2%").arg(size.name).arg(density);
+            long long cells = config.getCellCount();
+
+            // Reference board of the case, generated once
+            Board reference(config.width, config.height, config.mineCount);
+            generator.generate(reference, BOARD_SEED);
+            reference.setOpeningPending(false);
+            int opening = findLargestOpening(reference);
+
+            Board board = reference;
+
+            run("generate.placeMines" + suffix, cells, [&] { board.reset(); },
+                [&] { generator.placeMines(board, BOARD_SEED); });
+
+            run("generate.adjacency" + suffix, cells, [&] { board = reference; },
+                [&] { generator.calculateAdjacentMines(board); });
+
+            run("reveal.floodFill" + suffix, cells, [&] { board = reference; },
+                [&] { board.reveal(opening % config.width, opening / config.width); });
+
+            // Reveals every safe cell one by one and checks for a win after each move, like a game would
+            run("reveal.untilWon" + suffix, cells, [&] { board = reference; }, [&] {
+                for (int y = 0; y < config.height && !board.isWon(); y++) {
+                    for (int x = 0; x < config.width && !board.isWon(); x++) {
+                        if (!board.isMine(x, y)) {
+                            board.reveal(x, y);
+                        }
+                    }
+                }
+            });
+
+            // Starts a new game after one that ended right after its first opening, the common case
+            Solver solver(board);
+            std::vector<int> openedCells;
+            run("restart.solver" + suffix, cells, [&] {
+                board = reference;
+                openedCells.clear();
+                board.reveal(opening % config.width, opening / config.width, &openedCells);
+                solver.update(openedCells);
+                board = reference;
+            }, [&] { solver.reset(); });
+
+            if (cells <= MAX_GAME_CELLS) {
+                SolverStrategy strategy;
+                GameSimulator::Statistics statistics;
+                std::vector<Board> boards(GAMES_PER_SAMPLE, reference);
+
+                run("game.solver" + suffix, cells, [&] {
+                    for (int game = 0; game < GAMES_PER_SAMPLE; game++) {
+                        boards[game].reset();
+                        generator.generate(boards[game], BOARD_SEED + game);
+                    }
+                }, [&] {
+                    for (int game = 0; game < GAMES_PER_SAMPLE; game++) {
+                        GameSimulator::play(boards[game], strategy, BOARD_SEED + game, statistics);
+                    }
+                });
+
+                // Plays back and checks the replays of the same games, recorded once
+                std::vector<Replay> replays;
+                for (int game = 0; game < GAMES_PER_SAMPLE; game++) {
+                    boards[game].reset();
+                    generator.generate(boards[game], BOARD_SEED + game);
+                    replays.emplace_back(boards[game]);
+                    GameSimulator::play(boards[game], strategy, BOARD_SEED + game, statistics, &replays.back());
+                }
+                run("replay.verify" + suffix, cells, [] {}, [&] {
+                    for (const Replay &replay: replays) {
+                        ReplayEngine(replay).verify();
+                    }
+                });
+            }
+        }
+    }
+
+    // Materializes a viewport of 16 by 16 chunks of an endless board that was never played
+    std::unique_ptr<InfiniteBoard> endless;
+    constexpr std::int64_t VIEWPORT = 16 * InfiniteBoard::CHUNK_SIZE;
+    run("endless.prefetch/1024x1024", VIEWPORT * VIEWPORT,
+        [&] { endless = std::make_unique<InfiniteBoard>(BOARD_SEED); },
+        [&] { endless->prefetch(0, 0, VIEWPORT - 1, VIEWPORT - 1); });
+
+    return results;
+}
+
+}
+
+/**
+ * @function main
+ * @brief Entry point of the engine benchmarks.
+ *
+ * @param argc The number of command-line arguments.
+ * @param argv The command-line arguments.
+ * @return 0 on success, 1 on invalid options, 2 if the comparison found a regression.
+ */
+int main(int argc, char *argv[]) {
+    QCoreApplication application(argc, argv);
+    QCoreApplication::setApplicationName("Minesweeper Engine Benchmark");
+    QCoreApplication::setApplicationVersion("1.0.0");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Times the hot paths of the Minesweeper engine.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    QCommandLineOption filterOption("filter", "Only run the cases whose name contains the text.", "text");
+    QCommandLineOption minTimeOption("min-time", "Minimum measured time per case in seconds.", "seconds", "0.2");
+    QCommandLineOption threadsOption("threads", "Number of threads used to generate boards.", "count", "1");
+    QCommandLineOption saveOption("save", "Save the results as a JSON baseline.", "file");
+    QCommandLineOption compareOption("compare", "Compare the results with a JSON baseline.", "file");
+    QCommandLineOption thresholdOption("threshold", "Slowdown in percent that counts as a regression.", "percent",
+                                       "10");
+    parser.addOptions({filterOption, minTimeOption, threadsOption, saveOption, compareOption, thresholdOption});
+    parser.process(application);
+
+    double minSeconds = parser.value(minTimeOption).toDouble();
+    int threads = parser.value(threadsOption).toInt();
+    double threshold = parser.value(thresholdOption).toDouble();
+
+    if (minSeconds <= 0 || threads <= 0 || threshold < 0) {
+        qCritical() << "Invalid min-time, threads or threshold option";
+        return 1;
+    }
+
+    // Read the baseline first, so a missing file is reported before the cases run
+    QHash<QString, double> baseline;
+    if (parser.isSet(compareOption)) {
+        QFile file(parser.value(compareOption));
+        if (!file.open(QIODevice::ReadOnly)) {
+            qCritical() << "Cannot read the baseline " << file.fileName();
+            return 1;
+        }
+        for (const QJsonValue &value: QJsonDocument::fromJson(file.readAll()).object()["results"].toArray()) {
+            QJsonObject entry = value.toObject();
+            baseline.insert(entry["name"].toString(), entry["nanoseconds"].toDouble());
+        }
+    }
+
+    ThreadPool pool(threads);
+    std::vector<Result> results = runCases(threads > 1 ? &pool : nullptr, minSeconds,
+                                           parser.value(filterOption));
+
+    QTextStream out(stdout);
+    int regressions = 0;
+
+    out << "name,cells,samples,ns,ns_per_cell";
+    if (parser.isSet(compareOption)) {
+        out << ",baseline_ns,change_percent,status";
+    }
+    out << '\n';
+
+    for (const Result &result: results) {
+        out << result.name << ',' << result.cells << ',' << result.samples << ','
+            << qRound64(result.nanoseconds) << ',' << result.nanoseconds / static_cast<double>(result.cells);
+
+        if (parser.isSet(compareOption)) {
+            auto entry = baseline.constFind(result.name);
+            if (entry == baseline.constEnd() || *entry <= 0) {
+                out << ",,,new";
+            } else {
+                double change = (result.nanoseconds / *entry - 1) * 100;
+                bool regressed = change > threshold;
+                regressions += regressed;
+                out << ',' << qRound64(*entry) << ',' << change << ',' << (regressed ? "REGRESSION" : "ok");
+            }
+        }
+        out << '\n';
+    }
+    out.flush();
+
+    if (parser.isSet(saveOption)) {
+        QJsonArray entries;
+        for (const Result &result: results) {
+            entries.append(QJsonObject{
+                    {"name",        result.name},
+                    {"cells",       result.cells},
+                    {"samples",     result.samples},
+                    {"nanoseconds", result.nanoseconds}
+            });
+        }
+
+        QFile file(parser.value(saveOption));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            qCritical() << "Cannot write the baseline " << file.fileName();
+            return 1;
+        }
+        file.write(QJsonDocument(QJsonObject{{"threads", threads}, {"results", entries}}).toJson());
+    }
+
+    if (regressions > 0) {
+        qCritical() << regressions << " case(s) are more than " << threshold << "% slower than the baseline";
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,1186 @@
+/**
+ * @file enginetests.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Entry point of the engine tests.
+ *
+ * Checks the claims the engine makes about its results, such as reproducible and uniform boards,
+ * against straightforward reference computations on fixed seeds, so every run checks the same
+ * cases. The statistical checks allow six standard deviations, which fixed seeds never come near
+ * unless the code is wrong. The engine has no Qt dependency and neither have the tests. Every test
+ * whose name contains the first argument is run, all of them without one; the exit code is the
+ * number of failed tests.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "adjacency.h"
+#include "board.h"
+#include "boardgenerator.h"
+#include "boardprefetcher.h"
+#include "infiniteboard.h"
+#include "noguessgenerator.h"
+#include "probabilityengine.h"
+#include "random.h"
+#include "replay.h"
+#include "replayengine.h"
+#include "snapshot.h"
+#include "solver.h"
+#include "strategy.h"
+#include "threadpool.h"
+
+namespace {
+
+constexpr double MAX_DEVIATIONS = 6; // Standard deviations a statistical check may be off by
+
+int failedChecks = 0; // Failed checks of the running test
+
+void check(bool condition, const char *expression, const char *file, int line) {
+    if (!condition) {
+        std::printf("  %s:%d: check failed: %s\n", file, line, expression);
+        failedChecks++;
+    }
+}
+
+#define CHECK(condition) check((condition), #condition, __FILE__, __LINE__)
+
+// Checks that a count drawn n times with probability p is within MAX_DEVIATIONS of its mean
+bool isPlausible(long long count, long long n, double p) {
+    double mean = n * p;
+    return std::abs(count - mean) <= MAX_DEVIATIONS * std::sqrt(n * p * (1 - p)) + 1;
+}
+
+std::vector<std::uint64_t> getMinePlane(const Board &board) {
+    const std::uint64_t *plane = board.getMinePlane();
+    return {plane, plane + static_cast<std::size_t>(board.getWordsPerRow()) * board.getHeight()};
+}
+
+int countMines(const Board &board) {
+    int count = 0;
+    for (int y = 0; y < board.getHeight(); y++) {
+        for (int x = 0; x < board.getWidth(); x++) {
+            count += board.isMine(x, y);
+        }
+    }
+    return count;
+}
+
+void testRandomIsReproducible() {
+    Random first(42), second(42), other(43);
+    bool differs = false;
+    for (int i = 0; i < 1000; i++) {
+        std::uint64_t value = first.next();
+        CHECK(value == second.next());
+        differs |= value != other.next();
+    }
+    CHECK(differs);
+}
+
+void testNextBelowIsUniform() {
+    constexpr std::uint64_t BOUND = 7;
+    constexpr int DRAWS = 70000;
+    Random random(1);
+    long long counts[BOUND] = {};
+
+    for (int i = 0; i < DRAWS; i++) {
+        std::uint64_t value = random.nextBelow(BOUND);
+        CHECK(value < BOUND);
+        counts[value < BOUND ? value : 0]++;
+    }
+    for (long long count: counts) {
+        CHECK(isPlausible(count, DRAWS, 1.0 / BOUND));
+    }
+
+    // A bound just above a power of two is where a biased reduction would show most
+    std::uint64_t bound = (1ULL << 63) + 1;
+    long long upperHalf = 0;
+    for (int i = 0; i < DRAWS; i++) {
+        std::uint64_t value = random.nextBelow(bound);
+        CHECK(value < bound);
+        upperHalf += value >= bound / 2;
+    }
+    CHECK(isPlausible(upperHalf, DRAWS, 0.5));
+}
+
+void testPlacementIsReproducible() {
+    BoardGenerator generator;
+    for (std::uint64_t seed = 0; seed < 20; seed++) {
+        Board first(30, 16, 99), second(30, 16, 99), other(30, 16, 99);
+        generator.generate(first, seed);
+        generator.generate(second, seed);
+        generator.generate(other, seed + 1);
+
+        CHECK(countMines(first) == 99);
+        CHECK(first.getSeed() == seed);
+        CHECK(getMinePlane(first) == getMinePlane(second));
+        CHECK(getMinePlane(first) != getMinePlane(other));
+    }
+}
+
+void testPlacementIsUniform() {
+    constexpr int WIDTH = 4, HEIGHT = 4, MINES = 3, BOARDS = 32000;
+    BoardGenerator generator;
+    long long counts[WIDTH * HEIGHT] = {};
+
+    for (int seed = 0; seed < BOARDS; seed++) {
+        Board board(WIDTH, HEIGHT, MINES);
+        generator.placeMines(board, seed);
+        CHECK(countMines(board) == MINES);
+        for (int cell = 0; cell < WIDTH * HEIGHT; cell++) {
+            counts[cell] += board.isMine(cell % WIDTH, cell / WIDTH);
+        }
+    }
+    for (long long count: counts) {
+        CHECK(isPlausible(count, BOARDS, static_cast<double>(MINES) / (WIDTH * HEIGHT)));
+    }
+}
+
+// The adjacent mine count of every cell of a mine bitmap, zero for mines, counted one neighbour at a time
+std::vector<std::uint8_t> countAdjacentMines(const std::vector<std::uint64_t> &mines, int wordsPerRow, int width,
+                                             int height) {
+    auto isMine = [&](int x, int y) {
+        return x >= 0 && x < width && y >= 0 && y < height && (mines[y * wordsPerRow + x / 64] >> (x % 64)) & 1;
+    };
+
+    std::vector<std::uint8_t> counts(static_cast<std::size_t>(width) * height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int count = 0;
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    count += (dx != 0 || dy != 0) && isMine(x + dx, y + dy);
+                }
+            }
+            counts[y * width + x] = isMine(x, y) ? 0 : count;
+        }
+    }
+    return counts;
+}
+
+void testAdjacencyKernelsMatchReference() {
+    constexpr int WIDTHS[] = {1, 2, 3, 31, 63, 64, 65, 100, 128, 130, 200};
+    constexpr int HEIGHTS[] = {1, 2, 3, 17};
+    constexpr Adjacency::Kernel KERNELS[] = {Adjacency::Kernel::SCALAR, Adjacency::Kernel::BIT_SLICED,
+                                             Adjacency::Kernel::AVX2};
+    Random random(6);
+
+    for (int width: WIDTHS) {
+        for (int height: HEIGHTS) {
+            for (int percent: {0, 20, 50, 100}) {
+                int wordsPerRow = (width + 63) / 64;
+                std::vector<std::uint64_t> mines(static_cast<std::size_t>(wordsPerRow) * height);
+
+                for (int y = 0; y < height; y++) {
+                    for (int x = 0; x < width; x++) {
+                        if (static_cast<int>(random.nextBelow(100)) < percent) {
+                            mines[y * wordsPerRow + x / 64] |= 1ULL << (x % 64);
+                        }
+                    }
+                }
+                std::vector<std::uint8_t> expected = countAdjacentMines(mines, wordsPerRow, width, height);
+
+                for (Adjacency::Kernel kernel: KERNELS) {
+                    if (!Adjacency::isSupported(kernel)) {
+                        continue;
+                    }
+
+                    // The high nibble belongs to the board and must survive
+                    std::vector<std::uint8_t> cells(expected.size());
+                    for (std::uint8_t &cell: cells) {
+                        cell = static_cast<std::uint8_t>(random.next() & 0xF0);
+                    }
+                    std::vector<std::uint8_t> highNibbles = cells;
+
+                    Adjacency::compute(kernel, mines.data(), wordsPerRow, width, height, cells.data());
+                    bool matches = true;
+                    for (std::size_t i = 0; i < cells.size(); i++) {
+                        matches &= cells[i] == (highNibbles[i] | expected[i]);
+                    }
+                    CHECK(matches);
+
+                    // Bands computed separately must give the same counts along their borders
+                    std::vector<std::uint8_t> banded = highNibbles;
+                    for (int firstRow = 0; firstRow < height; firstRow += 2) {
+                        Adjacency::computeRows(kernel, mines.data(), wordsPerRow, width, height, firstRow,
+                                               std::min(height, firstRow + 2), banded.data());
+                    }
+                    CHECK(banded == cells);
+                }
+            }
+        }
+    }
+}
+
+void testTiledGenerationMatchesSerial() {
+    constexpr int WIDTH = 1000, HEIGHT = 1000, MINES = 160000;
+    ThreadPool pool(4);
+    BoardGenerator serial, parallel(&pool);
+
+    for (std::uint64_t seed = 0; seed < 3; seed++) {
+        Board first(WIDTH, HEIGHT, MINES), second(WIDTH, HEIGHT, MINES);
+        serial.generate(first, seed);
+        parallel.generate(second, seed);
+        CHECK(countMines(first) == MINES);
+        CHECK(getMinePlane(first) == getMinePlane(second));
+
+        std::vector<std::uint8_t> expected = countAdjacentMines(getMinePlane(second), second.getWordsPerRow(),
+                                                                WIDTH, HEIGHT);
+        bool matches = true;
+        for (int y = 0; y < HEIGHT; y++) {
+            for (int x = 0; x < WIDTH; x++) {
+                matches &= second.getAdjacentMines(x, y) == expected[y * WIDTH + x];
+            }
+        }
+        CHECK(matches);
+    }
+}
+
+void testBandMineCountsAreHypergeometric() {
+    // Rows wider than a band, so every row is a band of its own
+    constexpr int WIDTH = BoardGenerator::BAND_CELLS, HEIGHT = 4, BOARDS = 1000;
+    constexpr double CELLS = static_cast<double>(WIDTH) * HEIGHT;
+    BoardGenerator generator;
+
+    for (int mines: {1000, 50000}) {
+        double sum = 0, squares = 0;
+        for (int seed = 0; seed < BOARDS; seed++) {
+            Board board(WIDTH, HEIGHT, mines);
+            generator.placeMines(board, seed);
+
+            int firstBand = 0;
+            for (int word = 0; word < board.getWordsPerRow(); word++) {
+                firstBand += std::popcount(board.getMinePlane()[word]);
+            }
+            sum += firstBand;
+            squares += static_cast<double>(firstBand) * firstBand;
+        }
+
+        double share = mines / CELLS;
+        double mean = WIDTH * share;
+        double variance = mean * (1 - share) * (CELLS - WIDTH) / (CELLS - 1);
+        double sampleMean = sum / BOARDS;
+        double sampleVariance = (squares - sum * sum / BOARDS) / (BOARDS - 1);
+        CHECK(std::abs(sampleMean - mean) <= MAX_DEVIATIONS * std::sqrt(variance / BOARDS));
+        CHECK(std::abs(sampleVariance / variance - 1) <= MAX_DEVIATIONS * std::sqrt(2.0 / BOARDS));
+    }
+}
+
+// Compares everything a player or a saved file can see of two boards
+bool isSameBoard(const Board &first, const Board &second) {
+    if (first.getWidth() != second.getWidth() || first.getHeight() != second.getHeight() ||
+        first.getTopology() != second.getTopology() || first.getMineCount() != second.getMineCount() ||
+        first.getRevealedSafeCells() != second.getRevealedSafeCells() || first.isLost() != second.isLost() ||
+        first.isWon() != second.isWon() || first.isOpeningPending() != second.isOpeningPending()) {
+        return false;
+    }
+
+    for (int y = 0; y < first.getHeight(); y++) {
+        for (int x = 0; x < first.getWidth(); x++) {
+            if (first.isMine(x, y) != second.isMine(x, y) || first.isRevealed(x, y) != second.isRevealed(x, y) ||
+                first.isExploded(x, y) != second.isExploded(x, y) || first.getMark(x, y) != second.getMark(x, y) ||
+                first.getAdjacentMines(x, y) != second.getAdjacentMines(x, y)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::string getTemporaryPath(const char *name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// A board with mines at the given cells, whose first reveal does not move them
+Board makeBoard(int width, int height, const std::vector<int> &mines,
+                Topology::Kind topology = Topology::Kind::RECTANGLE) {
+    Board board(width, height, static_cast<int>(mines.size()), topology);
+    for (int mine: mines) {
+        board.setMine(mine % width, mine / width, true);
+    }
+    board.calculateAdjacentMines();
+    board.setOpeningPending(false);
+    return board;
+}
+
+void testFloodFillMatchesBreadthFirstSearch() {
+    constexpr int WIDTH = 30, HEIGHT = 16, CELLS = WIDTH * HEIGHT;
+    BoardGenerator generator;
+    Random random(4);
+
+    for (Topology::Kind topology: {Topology::Kind::RECTANGLE, Topology::Kind::TORUS, Topology::Kind::HEX}) {
+        std::shared_ptr<const Topology> neighbours = Topology::get(topology, WIDTH, HEIGHT);
+        for (int mines: {10, 40, 99}) {
+            for (std::uint64_t seed = 0; seed < 10; seed++) {
+                Board board(WIDTH, HEIGHT, mines, topology);
+                generator.generate(board, seed);
+                board.setOpeningPending(false);
+
+                for (int click = 0; click < 10; click++) {
+                    int start = static_cast<int>(random.nextBelow(CELLS));
+                    if (board.isMine(start % WIDTH, start / WIDTH) || board.isRevealed(start % WIDTH, start / WIDTH)) {
+                        continue;
+                    }
+
+                    // Breadth-first from the clicked cell, opening past every hidden cell without a neighbouring mine
+                    std::vector<char> reached(CELLS, 0);
+                    std::vector<int> queue(1, start);
+                    reached[start] = 1;
+                    for (std::size_t next = 0; next < queue.size(); next++) {
+                        int cell = queue[next];
+                        if (board.getAdjacentMines(cell % WIDTH, cell / WIDTH) != 0) {
+                            continue;
+                        }
+                        for (int neighbour: neighbours->getNeighbours(cell)) {
+                            if (!reached[neighbour] && !board.isRevealed(neighbour % WIDTH, neighbour / WIDTH)) {
+                                reached[neighbour] = 1;
+                                queue.push_back(neighbour);
+                            }
+                        }
+                    }
+                    std::vector<char> revealedBefore(CELLS);
+                    for (int cell = 0; cell < CELLS; cell++) {
+                        revealedBefore[cell] = board.isRevealed(cell % WIDTH, cell / WIDTH);
+                    }
+                    int safeCellsBefore = board.getRevealedSafeCells();
+
+                    std::vector<int> revealed;
+                    CHECK(board.reveal(start % WIDTH, start / WIDTH, &revealed) == Board::RevealResult::SAFE);
+                    std::sort(queue.begin(), queue.end());
+                    std::sort(revealed.begin(), revealed.end());
+                    CHECK(std::adjacent_find(revealed.begin(), revealed.end()) == revealed.end());
+                    CHECK(revealed == queue);
+                    CHECK(board.getRevealedSafeCells() == safeCellsBefore + static_cast<int>(queue.size()));
+
+                    bool matches = true;
+                    for (int cell = 0; cell < CELLS; cell++) {
+                        bool expected = revealedBefore[cell] || reached[cell];
+                        matches &= board.isRevealed(cell % WIDTH, cell / WIDTH) == expected;
+                    }
+                    CHECK(matches);
+                }
+            }
+        }
+    }
+}
+
+void testOpeningMovesMinesConsistently() {
+    // From sparse to so dense that the mines are drawn from a candidate list, or that only the clicked
+    // cell can be cleared, with clicks in a corner, on an edge and inside
+    constexpr int WIDTH = 30, HEIGHT = 16;
+    constexpr std::pair<int, int> CLICKS[] = {{0, 0}, {WIDTH - 1, HEIGHT - 1}, {0, 7}, {15, 8}};
+    BoardGenerator generator;
+    for (int mines: {99, 300, 470, 473}) {
+        for (std::uint64_t seed = 0; seed < 40; seed++) {
+            Board board(WIDTH, HEIGHT, mines), same(WIDTH, HEIGHT, mines);
+            generator.generate(board, seed);
+            generator.generate(same, seed);
+            auto [x, y] = CLICKS[seed % std::size(CLICKS)];
+
+            int zoneCells = 0, zoneMines = 0;
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    if (board.contains(x + dx, y + dy)) {
+                        zoneCells++;
+                        zoneMines += board.isMine(x + dx, y + dy);
+                    }
+                }
+            }
+            bool wholeZone = (WIDTH * HEIGHT - mines) - (zoneCells - zoneMines) >= zoneMines;
+
+            CHECK(board.reveal(x, y) == Board::RevealResult::SAFE);
+            if (wholeZone) {
+                bool zoneCleared = true;
+                for (int dy = -1; dy <= 1; dy++) {
+                    for (int dx = -1; dx <= 1; dx++) {
+                        zoneCleared &= !board.contains(x + dx, y + dy) || !board.isMine(x + dx, y + dy);
+                    }
+                }
+                CHECK(zoneCleared);
+            }
+            CHECK(countMines(board) == mines);
+
+            Board recounted = board;
+            recounted.calculateAdjacentMines();
+            std::vector<std::uint8_t> expected = countAdjacentMines(getMinePlane(board), board.getWordsPerRow(),
+                                                                    WIDTH, HEIGHT);
+            bool matches = true;
+            for (int cellY = 0; cellY < HEIGHT; cellY++) {
+                for (int cellX = 0; cellX < WIDTH; cellX++) {
+                    matches &= board.getAdjacentMines(cellX, cellY) == recounted.getAdjacentMines(cellX, cellY);
+                    matches &= board.isMine(cellX, cellY) ||
+                               board.getAdjacentMines(cellX, cellY) == expected[cellY * WIDTH + cellX];
+                }
+            }
+            CHECK(matches);
+
+            same.reveal(x, y);
+            CHECK(isSameBoard(board, same));
+        }
+    }
+}
+
+void testSolverFindsOneTwoOne() {
+    // The revealed row reads 1 1 2 1 1; only comparing overlapping constraints finds the mines above it
+    Board board = makeBoard(5, 2, {1, 3});
+    std::vector<int> revealed;
+    for (int x = 0; x < 5; x++) {
+        board.reveal(x, 1, &revealed);
+    }
+
+    Solver solver(board);
+    solver.update(revealed);
+    for (int x = 0; x < 5; x++) {
+        CHECK(solver.isKnownMine(x, 0) == board.isMine(x, 0));
+        CHECK(solver.isKnownSafe(x, 0) == !board.isMine(x, 0));
+    }
+    CHECK(solver.getKnownMines().size() == 2);
+}
+
+void testSolverDeductionsAreSound() {
+    BoardGenerator generator;
+    int deducedMoves = 0;
+
+    for (Topology::Kind topology: {Topology::Kind::RECTANGLE, Topology::Kind::TORUS, Topology::Kind::HEX}) {
+        for (std::uint64_t seed = 0; seed < 40; seed++) {
+            Board board(30, 16, 80, topology);
+            generator.generate(board, seed);
+            std::vector<int> revealed;
+            board.reveal(15, 8, &revealed);
+
+            Solver solver(board);
+            bool sound = true;
+            while (!board.isLost() && !board.isWon()) {
+                solver.update(revealed);
+                for (int mine: solver.getKnownMines()) {
+                    sound &= board.isMine(mine % 30, mine / 30);
+                }
+
+                int cell = solver.findSafeCell();
+                if (cell < 0) {
+                    break;
+                }
+                revealed.clear();
+                board.reveal(cell % 30, cell / 30, &revealed);
+                deducedMoves++;
+            }
+            CHECK(sound);
+            CHECK(!board.isLost());
+        }
+    }
+    CHECK(deducedMoves > 1000);
+}
+
+// Checks that a solver knows exactly what a solver built from scratch on the same board knows
+bool isSameAsFresh(Solver &solver, const Board &board) {
+    Solver fresh(board);
+    bool same = solver.getKnownMines() == fresh.getKnownMines();
+    for (int y = 0; y < board.getHeight(); y++) {
+        for (int x = 0; x < board.getWidth(); x++) {
+            same &= solver.isKnownSafe(x, y) == fresh.isKnownSafe(x, y);
+            same &= solver.isKnownMine(x, y) == fresh.isKnownMine(x, y);
+        }
+    }
+    return same && solver.findSafeCell() == fresh.findSafeCell();
+}
+
+void testSolverResetMatchesFreshSolver() {
+    constexpr int WIDTH = 30, HEIGHT = 16;
+    BoardGenerator generator;
+    Board board(WIDTH, HEIGHT, 99);
+    Solver solver(board);
+    Random random(3);
+    int lostGames = 0;
+
+    for (std::uint64_t seed = 0; seed < 30; seed++) {
+        generator.generate(board, seed);
+        std::vector<int> revealed;
+        board.reveal(WIDTH / 2, HEIGHT / 2, &revealed);
+        solver.reset();
+        CHECK(isSameAsFresh(solver, board));
+
+        // Deduce as far as possible and guess when stuck; every third game steps on a mine on purpose
+        for (int moves = 0; !board.isLost() && !board.isWon(); moves++) {
+            solver.update(revealed);
+            int cell = solver.findSafeCell();
+            while (cell < 0 || board.isRevealed(cell % WIDTH, cell / WIDTH) ||
+                   (seed % 3 == 0 && moves >= 10 && !board.isMine(cell % WIDTH, cell / WIDTH))) {
+                cell = static_cast<int>(random.nextBelow(WIDTH * HEIGHT));
+            }
+            revealed.clear();
+            board.reveal(cell % WIDTH, cell / WIDTH, &revealed);
+        }
+
+        // Resetting on the lost board reads every revealed cell, also after the whole board is shown
+        if (board.isLost()) {
+            lostGames++;
+            solver.reset();
+            CHECK(isSameAsFresh(solver, board));
+            board.revealAll();
+            solver.reset();
+            CHECK(isSameAsFresh(solver, board));
+        }
+    }
+    CHECK(lostGames >= 10);
+}
+
+void testTopologyTablesMatchHandWrittenNeighbours() {
+    struct Case {
+        Topology::Kind kind;
+        int width;
+        int height;
+        int cell;
+        std::vector<int> neighbours; // Sorted, each listed once
+    };
+    const Case cases[] = {
+            // A torus narrower or lower than three cells reaches a neighbour from both sides, or itself
+            {Topology::Kind::TORUS, 1, 1, 0, {}},
+            {Topology::Kind::TORUS, 2, 1, 0, {1}},
+            {Topology::Kind::TORUS, 1, 2, 1, {0}},
+            {Topology::Kind::TORUS, 2, 2, 3, {0, 1, 2}},
+            {Topology::Kind::TORUS, 3, 1, 0, {1, 2}},
+            {Topology::Kind::TORUS, 1, 3, 2, {0, 1}},
+            {Topology::Kind::TORUS, 2, 3, 0, {1, 2, 3, 4, 5}},
+            {Topology::Kind::TORUS, 4, 4, 0, {1, 3, 4, 5, 7, 12, 13, 15}},
+            {Topology::Kind::TORUS, 4, 4, 6, {1, 2, 3, 5, 7, 9, 10, 11}},
+            // Odd rows are shifted right, so they reach one cell further right in the rows around them
+            {Topology::Kind::HEX, 4, 4, 0, {1, 4}},
+            {Topology::Kind::HEX, 4, 4, 1, {0, 2, 4, 5}},
+            {Topology::Kind::HEX, 4, 4, 3, {2, 6, 7}},
+            {Topology::Kind::HEX, 4, 4, 4, {0, 1, 5, 8, 9}},
+            {Topology::Kind::HEX, 4, 4, 5, {1, 2, 4, 6, 9, 10}},
+            {Topology::Kind::HEX, 4, 4, 7, {3, 6, 11}},
+            {Topology::Kind::HEX, 4, 4, 8, {4, 9, 12}},
+            {Topology::Kind::HEX, 4, 4, 9, {4, 5, 8, 10, 12, 13}},
+            {Topology::Kind::HEX, 4, 4, 12, {8, 9, 13}},
+            {Topology::Kind::HEX, 4, 4, 15, {11, 14}},
+            {Topology::Kind::HEX, 1, 2, 0, {1}},
+            {Topology::Kind::HEX, 1, 2, 1, {0}},
+    };
+
+    for (const Case &test: cases) {
+        std::shared_ptr<const Topology> topology = Topology::get(test.kind, test.width, test.height);
+        Topology::Neighbours neighbours = topology->getNeighbours(test.cell);
+        std::vector<int> listed(neighbours.begin(), neighbours.end());
+        std::sort(listed.begin(), listed.end());
+        CHECK(listed == test.neighbours);
+
+        // Every neighbour lists the cell back in the reverse slot
+        std::vector<int> visited;
+        topology->forEachNeighbour(test.cell, [&](int neighbour) {
+            visited.push_back(neighbour);
+        });
+        CHECK(std::equal(visited.begin(), visited.end(), neighbours.begin(), neighbours.end()));
+        for (std::size_t slot = 0; slot < neighbours.size(); slot++) {
+            Topology::Neighbours back = topology->getNeighbours(neighbours[slot]);
+            CHECK(back[static_cast<std::size_t>(topology->getReverseSlot(neighbours, slot))] == test.cell);
+        }
+    }
+}
+
+void testNoGuessBoardsAreSolvedWithoutGuessing() {
+    ThreadPool pool(4);
+    NoGuessGenerator serial, parallel(&pool);
+    const BoardConfig configs[] = {BoardConfig::beginner(), BoardConfig::intermediate(),
+                                   {16, 16, 40, Topology::Kind::TORUS}};
+
+    for (const BoardConfig &config: configs) {
+        int startX = config.width / 2, startY = config.height / 2;
+        for (std::uint64_t seed = 0; seed < 8; seed++) {
+            Board board(config.width, config.height, config.mineCount, config.topology);
+            Board same(config.width, config.height, config.mineCount, config.topology);
+            CHECK(serial.generate(board, seed, startX, startY));
+            CHECK(parallel.generate(same, seed, startX, startY));
+            CHECK(isSameBoard(board, same));
+            CHECK(countMines(board) == config.mineCount);
+
+            // The solver wins from the start cell alone, without a single guess
+            std::vector<int> revealed;
+            CHECK(board.reveal(startX, startY, &revealed) == Board::RevealResult::SAFE);
+            Solver solver(board);
+            for (int cell = solver.findSafeCell(); cell >= 0 && !board.isWon(); cell = solver.findSafeCell()) {
+                revealed.clear();
+                board.reveal(cell % config.width, cell / config.width, &revealed);
+                solver.update(revealed);
+            }
+            CHECK(board.isWon());
+        }
+    }
+
+    // A stop request ends the search without a board
+    std::stop_source stopped;
+    stopped.request_stop();
+    Board board(30, 16, 99);
+    CHECK(!serial.generate(board, 1, 15, 8, stopped.get_token()));
+    CHECK(!parallel.generate(board, 1, 15, 8, stopped.get_token()));
+}
+
+void testPrefetcherDropsStaleBoards() {
+    using namespace std::chrono_literals;
+    auto waitFor = [](auto condition) {
+        auto deadline = std::chrono::steady_clock::now() + 10s;
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    };
+
+    BoardPrefetcher prefetcher(5, 2);
+    prefetcher.configure(BoardConfig::beginner(), [](Board &board, std::uint64_t seed, std::stop_token) {
+        BoardGenerator().generate(board, seed);
+        return true;
+    });
+    CHECK(waitFor([&] { return prefetcher.getReadyCount() == 2; }));
+
+    // A board that is still being generated when the settings change finishes anyway, but is stale
+    std::atomic<bool> started(false);
+    prefetcher.configure(BoardConfig::intermediate(), [&](Board &board, std::uint64_t seed, std::stop_token stop) {
+        started = true;
+        while (!stop.stop_requested()) {
+            std::this_thread::sleep_for(1ms);
+        }
+        BoardGenerator().generate(board, seed);
+        return true;
+    });
+    CHECK(prefetcher.getReadyCount() == 0);
+    CHECK(!prefetcher.take().has_value());
+    CHECK(waitFor([&] { return started.load(); }));
+
+    BoardConfig config{20, 10, 30};
+    prefetcher.configure(config, [&](Board &board, std::uint64_t seed, std::stop_token stop) {
+        return NoGuessGenerator().generate(board, seed, config.width / 2, config.height / 2, stop);
+    });
+    for (int taken = 0; taken < 6; taken++) {
+        std::optional<Board> board;
+        CHECK(waitFor([&] { return (board = prefetcher.take()).has_value(); }));
+        if (board) {
+            CHECK(board->getWidth() == config.width && board->getHeight() == config.height);
+            CHECK(board->getMineCount() == config.mineCount && countMines(*board) == config.mineCount);
+            CHECK(!board->isOpeningPending()); // Only the no-guess boards have their opening cleared
+        }
+    }
+}
+
+void testProbabilitiesOfCornerOne() {
+    // A 1 in the corner puts one mine among its three neighbours, so the other mine is among the
+    // five cells further out
+    Board board = makeBoard(3, 3, {4, 8});
+    board.reveal(0, 0);
+
+    ProbabilityEngine engine;
+    engine.compute(board);
+    CHECK(engine.getProbability(0, 0) == -1);
+    for (int cell: {1, 3, 4}) {
+        CHECK(std::abs(engine.getProbability(cell % 3, cell / 3) - 1.0 / 3) < 1e-12);
+    }
+    for (int cell: {2, 5, 6, 7, 8}) {
+        CHECK(std::abs(engine.getProbability(cell % 3, cell / 3) - 1.0 / 5) < 1e-12);
+    }
+}
+
+void testProbabilitiesMatchEnumeration() {
+    constexpr int WIDTH = 6, HEIGHT = 4, CELLS = WIDTH * HEIGHT, MINES = 5;
+    ThreadPool pool(4);
+    ProbabilityEngine engine, parallelEngine(&pool);
+    BoardGenerator generator;
+    Random random(10);
+
+    for (Topology::Kind topology: {Topology::Kind::RECTANGLE, Topology::Kind::TORUS, Topology::Kind::HEX}) {
+        std::shared_ptr<const Topology> neighbours = Topology::get(topology, WIDTH, HEIGHT);
+        std::uint32_t neighbourMasks[CELLS] = {};
+        for (int cell = 0; cell < CELLS; cell++) {
+            for (int neighbour: neighbours->getNeighbours(cell)) {
+                neighbourMasks[cell] |= 1u << neighbour;
+            }
+        }
+
+        for (std::uint64_t seed = 0; seed < 10; seed++) {
+            Board board(WIDTH, HEIGHT, MINES, topology);
+            generator.generate(board, seed);
+            board.reveal(0, 0);
+            for (int move = 0; move < static_cast<int>(seed % 4); move++) {
+                int cell = static_cast<int>(random.nextBelow(CELLS));
+                if (!board.isMine(cell % WIDTH, cell / WIDTH)) {
+                    board.reveal(cell % WIDTH, cell / WIDTH);
+                }
+            }
+
+            // Every layout of the mines that agrees with the revealed numbers is equally likely
+            std::uint32_t revealed = 0;
+            for (int cell = 0; cell < CELLS; cell++) {
+                revealed |= static_cast<std::uint32_t>(board.isRevealed(cell % WIDTH, cell / WIDTH)) << cell;
+            }
+            double layouts = 0;
+            double mineLayouts[CELLS] = {};
+            for (std::uint32_t mines = (1u << MINES) - 1; mines < 1u << CELLS;) {
+                bool consistent = (mines & revealed) == 0;
+                for (int cell = 0; cell < CELLS && consistent; cell++) {
+                    consistent = !((revealed >> cell) & 1) ||
+                                 std::popcount(mines & neighbourMasks[cell]) ==
+                                 board.getAdjacentMines(cell % WIDTH, cell / WIDTH);
+                }
+                if (consistent) {
+                    layouts++;
+                    for (int cell = 0; cell < CELLS; cell++) {
+                        mineLayouts[cell] += (mines >> cell) & 1;
+                    }
+                }
+
+                // The next larger number with as many bits set
+                std::uint32_t lowest = mines & -mines;
+                std::uint32_t ripple = mines + lowest;
+                mines = ripple | (((mines ^ ripple) >> 2) / lowest);
+            }
+
+            engine.compute(board);
+            parallelEngine.compute(board);
+            CHECK(engine.getProbabilities() == parallelEngine.getProbabilities());
+            bool matches = true;
+            for (int cell = 0; cell < CELLS; cell++) {
+                double expected = (revealed >> cell) & 1 ? -1 : mineLayouts[cell] / layouts;
+                matches &= std::abs(engine.getProbability(cell % WIDTH, cell / WIDTH) - expected) < 1e-9;
+            }
+            CHECK(matches);
+        }
+    }
+}
+
+void testProbabilitiesGiveUpOnLongSearches() {
+    // Every other cell of the middle row revealed leaves one component along the whole board,
+    // whose solutions grow exponentially with its length
+    constexpr int WIDTH = 400;
+    Random random(11);
+    std::vector<int> mines;
+    for (int cell = 0; cell < 3 * WIDTH; cell++) {
+        if ((cell / WIDTH != 1 || cell % 2 == 1) && random.nextBelow(2) == 0) {
+            mines.push_back(cell);
+        }
+    }
+    Board board = makeBoard(WIDTH, 3, mines);
+    for (int x = 0; x < WIDTH; x += 2) {
+        board.reveal(x, 1);
+    }
+    int hiddenCells = 3 * WIDTH - board.getRevealedSafeCells();
+    double share = static_cast<double>(mines.size()) / hiddenCells;
+
+    ProbabilityEngine engine;
+    CHECK(!engine.compute(board));
+    bool uniform = true;
+    for (int cell = 0; cell < 3 * WIDTH; cell++) {
+        double expected = board.isRevealed(cell % WIDTH, cell / WIDTH) ? -1 : share;
+        uniform &= engine.getProbability(cell % WIDTH, cell / WIDTH) == expected;
+    }
+    CHECK(uniform);
+
+    // A position that is quick to enumerate still stops when asked to
+    Board small = makeBoard(3, 3, {4, 8});
+    small.reveal(0, 0);
+    std::stop_source stopped;
+    stopped.request_stop();
+    CHECK(!engine.compute(small, stopped.get_token()));
+    CHECK(engine.compute(small));
+}
+
+void testSnapshotRoundTrip() {
+    std::string path = getTemporaryPath("minesweeper_tests.msnap");
+    BoardGenerator generator;
+    Random random(20);
+
+    for (Topology::Kind topology: {Topology::Kind::RECTANGLE, Topology::Kind::TORUS, Topology::Kind::HEX}) {
+        // Widths on both sides of a word, and a game that goes on until it is lost
+        for (int width: {9, 64, 65, 130}) {
+            Board board(width, 20, width * 3, topology);
+            generator.generate(board, width);
+            board.reveal(width / 2, 10);
+            while (!board.isLost()) {
+                int cell = static_cast<int>(random.nextBelow(width * 20));
+                if (random.nextBelow(4) == 0) {
+                    board.cycleMark(cell % width, cell / width);
+                } else {
+                    board.reveal(cell % width, cell / width);
+                }
+
+                if (random.nextBelow(8) == 0 || board.isLost()) {
+                    CHECK(Snapshot::save(board, path));
+                    std::unique_ptr<Snapshot> snapshot = Snapshot::open(path);
+                    CHECK(snapshot != nullptr);
+                    if (snapshot) {
+                        CHECK(snapshot->getSeed() == board.getSeed());
+                        CHECK(isSameBoard(snapshot->toBoard(), board));
+                    }
+                }
+            }
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+void testSnapshotRejectsCorruption() {
+    std::string path = getTemporaryPath("minesweeper_tests.msnap");
+    Board board(30, 16, 99);
+    BoardGenerator().generate(board, 20);
+    board.reveal(15, 8);
+    CHECK(Snapshot::save(board, path));
+
+    std::ifstream in(path, std::ios::binary);
+    std::vector<char> bytes{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    in.close();
+    auto write = [&](const std::vector<char> &contents) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    };
+
+    // Every byte is covered by the checksum or checked against the header
+    for (std::size_t i = 0; i < bytes.size(); i += 7) {
+        std::vector<char> corrupt = bytes;
+        corrupt[i] ^= 0x10;
+        write(corrupt);
+        CHECK(Snapshot::open(path) == nullptr);
+    }
+    write({bytes.begin(), bytes.end() - 8});
+    CHECK(Snapshot::open(path) == nullptr);
+    write(bytes);
+    CHECK(Snapshot::open(path) != nullptr);
+
+    // A file whose checksum matches can still disagree with itself, so the header is rewritten and
+    // sealed again the way Snapshot::save() does: revealedSafeCells at byte 40, explodedIndex at 44,
+    // wordsPerPlane at 48 and the checksum at 56, followed by the mine plane and the revealed plane
+    auto seal = [&](std::vector<char> contents, std::int32_t revealedSafeCells, std::int32_t explodedIndex,
+                    int revealedMine) {
+        std::memcpy(&contents[40], &revealedSafeCells, sizeof revealedSafeCells);
+        std::memcpy(&contents[44], &explodedIndex, sizeof explodedIndex);
+        std::uint64_t wordsPerPlane;
+        std::memcpy(&wordsPerPlane, &contents[48], sizeof wordsPerPlane);
+        std::vector<std::uint64_t> words(contents.size() / sizeof(std::uint64_t));
+        std::memcpy(words.data(), contents.data(), contents.size());
+        if (revealedMine >= 0) {
+            words[8 + wordsPerPlane + revealedMine / 64] |= 1ULL << (revealedMine % 64);
+        }
+        words[7] = 0;
+        std::uint64_t hash = 0;
+        for (std::uint64_t word: words) {
+            hash = Random::mix(hash ^ word);
+        }
+        words[7] = hash;
+        std::memcpy(contents.data(), words.data(), contents.size());
+        write(contents);
+    };
+
+    int mine = 0;
+    while (!board.isMine(mine % 30, mine / 30)) {
+        mine++;
+    }
+    int safe = 8 * 30 + 15;
+    int revealed = board.getRevealedSafeCells();
+    seal(bytes, revealed, -1, -1);
+    CHECK(Snapshot::open(path) != nullptr);
+    seal(bytes, revealed + 1, -1, -1);
+    CHECK(Snapshot::open(path) == nullptr);
+    seal(bytes, revealed - 1, -1, -1);
+    CHECK(Snapshot::open(path) == nullptr);
+    seal(bytes, revealed, -1, mine);
+    CHECK(Snapshot::open(path) == nullptr);
+    seal(bytes, revealed, mine, mine);
+    CHECK(Snapshot::open(path) != nullptr);
+    seal(bytes, revealed, mine, -1);
+    CHECK(Snapshot::open(path) == nullptr);
+    seal(bytes, revealed, safe, -1);
+    CHECK(Snapshot::open(path) == nullptr);
+
+    // Lost boards, shown completely or not, are still written so that they can be read back
+    board.reveal(mine % 30, mine / 30);
+    CHECK(Snapshot::save(board, path) && Snapshot::open(path) != nullptr);
+    board.revealAll();
+    CHECK(Snapshot::save(board, path) && Snapshot::open(path) != nullptr);
+    std::filesystem::remove(path);
+}
+
+void testInfiniteBoardCountsAcrossChunks() {
+    constexpr std::int64_t SIZE = InfiniteBoard::CHUNK_SIZE;
+    InfiniteBoard board(21, 0.3);
+    InfiniteBoard other(21, 0.3);
+
+    for (int y = -1; y <= 1; y++) {
+        for (int x = -1; x <= 1; x++) {
+            CHECK(!board.isMine(x, y));
+        }
+    }
+
+    // Rows and columns on both sides of the chunk borders, first from the hashes, then materialized
+    std::vector<std::int64_t> lines = {-SIZE - 1, -SIZE, -1, 0, SIZE - 1, SIZE, 5 * SIZE - 1, 5 * SIZE};
+    for (bool materialized: {false, true}) {
+        if (materialized) {
+            board.prefetch(-2 * SIZE, -2 * SIZE, 6 * SIZE, 6 * SIZE);
+        }
+
+        bool matches = true;
+        for (std::int64_t y: lines) {
+            for (std::int64_t x = -2 * SIZE; x < 6 * SIZE; x++) {
+                for (auto [cellX, cellY]: {std::pair(x, y), std::pair(y, x)}) {
+                    int count = 0;
+                    for (int dy = -1; dy <= 1; dy++) {
+                        for (int dx = -1; dx <= 1; dx++) {
+                            count += (dx != 0 || dy != 0) && board.isMine(cellX + dx, cellY + dy);
+                        }
+                    }
+                    matches &= board.getAdjacentMines(cellX, cellY) == (board.isMine(cellX, cellY) ? 0 : count);
+                    matches &= board.isMine(cellX, cellY) == other.isMine(cellX, cellY);
+                }
+            }
+        }
+        CHECK(matches);
+    }
+}
+
+void testInfiniteBoardRebuildsEvictedChunks() {
+    constexpr std::int64_t SIZE = InfiniteBoard::CHUNK_SIZE;
+    constexpr std::size_t MAX_CHUNKS = 16; // The fewest a board keeps
+    InfiniteBoard board(21, 0.15, MAX_CHUNKS);
+    InfiniteBoard reference(21, 0.15);
+    Random random(21);
+
+    // Spread moves over many chunks, so the small board keeps evicting
+    auto play = [&](std::int64_t x, std::int64_t y, bool mark) {
+        if (mark) {
+            board.cycleMark(x, y);
+            reference.cycleMark(x, y);
+        } else if (!reference.isMine(x, y)) {
+            board.reveal(x, y);
+            reference.reveal(x, y);
+        }
+    };
+    play(0, 0, false);
+    for (int move = 0; move < 400; move++) {
+        auto x = static_cast<std::int64_t>(random.nextBelow(12 * SIZE)) - 6 * SIZE;
+        auto y = static_cast<std::int64_t>(random.nextBelow(12 * SIZE)) - 6 * SIZE;
+        play(x, y, random.nextBelow(3) == 0);
+    }
+    CHECK(board.getMaterializedChunkCount() <= MAX_CHUNKS);
+    CHECK(board.getStoredChunkCount() > MAX_CHUNKS);
+    CHECK(board.getRevealedSafeCells() == reference.getRevealedSafeCells());
+    CHECK(!board.isLost());
+
+    auto matchesReference = [&]() {
+        bool matches = true;
+        for (std::int64_t y = -7 * SIZE; y < 7 * SIZE; y++) {
+            for (std::int64_t x = -7 * SIZE; x < 7 * SIZE; x++) {
+                matches &= board.isRevealed(x, y) == reference.isRevealed(x, y) &&
+                           board.getMark(x, y) == reference.getMark(x, y);
+            }
+        }
+        return matches;
+    };
+
+    // Read once from the stored planes, and once after every chunk was rebuilt from them and evicted again
+    board.evict(0);
+    CHECK(board.getMaterializedChunkCount() == 0);
+    CHECK(matchesReference());
+    for (std::int64_t y = -7 * SIZE; y < 7 * SIZE; y += 2 * SIZE) {
+        for (std::int64_t x = -7 * SIZE; x < 7 * SIZE; x += 2 * SIZE) {
+            board.prefetch(x, y, x + 2 * SIZE - 1, y + 2 * SIZE - 1);
+        }
+    }
+    CHECK(matchesReference());
+    CHECK(board.getRevealedSafeCells() == reference.getRevealedSafeCells());
+}
+
+// Plays random moves of every kind, mostly on safe cells so games get past several checkpoints
+void playRecordedGame(Board &board, Replay &replay, Random &random, int maxMoves) {
+    int width = board.getWidth();
+    int cells = width * board.getHeight();
+    std::vector<int> changedCells;
+    std::uint32_t time = 0;
+
+    for (int move = 0; move < maxMoves && !board.isLost() && !board.isWon(); move++) {
+        int cell = static_cast<int>(random.nextBelow(cells));
+        int x = cell % width, y = cell / width;
+        Replay::MoveType type = Replay::MoveType::REVEAL;
+
+        switch (random.nextBelow(8)) {
+            case 0:
+                type = Replay::MoveType::CYCLE_MARK;
+                board.cycleMark(x, y);
+                break;
+            case 1:
+                type = Replay::MoveType::FLAG;
+                Action::apply(board, {Action::Type::FLAG, x, y}, changedCells);
+                break;
+            case 2:
+                type = Replay::MoveType::CHORD;
+                Action::apply(board, {Action::Type::CHORD, x, y}, changedCells);
+                break;
+            default:
+                // The first reveal moves the mines away, and now and then a game is lost on purpose
+                if (board.isMine(x, y) && !board.isOpeningPending() && random.nextBelow(400) != 0) {
+                    continue;
+                }
+                Action::apply(board, {Action::Type::REVEAL, x, y}, changedCells);
+                break;
+        }
+        time += static_cast<std::uint32_t>(random.nextBelow(1000));
+        replay.record(board, {type, cell, time});
+    }
+}
+
+void testReplayPlaysBack() {
+    const BoardConfig configs[] = {BoardConfig::expert(), {100, 100, 1500}, {30, 16, 99, Topology::Kind::TORUS},
+                                   {30, 16, 80, Topology::Kind::HEX}};
+    std::string path = getTemporaryPath("minesweeper_tests.msrep");
+    BoardGenerator generator;
+    Random random(25);
+
+    for (const BoardConfig &config: configs) {
+        for (std::uint64_t seed = 0; seed < 10; seed++) {
+            Board board(config.width, config.height, config.mineCount, config.topology);
+            generator.generate(board, seed);
+            Replay recorded(board);
+            playRecordedGame(board, recorded, random, 3 * Replay::CHECKPOINT_INTERVAL);
+
+            CHECK(recorded.save(path));
+            std::optional<Replay> replay = Replay::load(path);
+            CHECK(replay.has_value());
+            if (!replay) {
+                continue;
+            }
+            CHECK(replay->getMoveCount() == recorded.getMoveCount());
+
+            ReplayEngine engine(*replay);
+            CHECK(engine.verify());
+            CHECK(engine.getPosition() == replay->getMoveCount());
+            CHECK(isSameBoard(engine.getBoard(), board));
+
+            // Seeks in both directions, on and around the checkpoints, must match stepping there
+            int moves = replay->getMoveCount();
+            std::vector<int> targets = {moves, 0, moves - 1, 1};
+            for (int checkpoint = Replay::CHECKPOINT_INTERVAL; checkpoint < moves;
+                 checkpoint += Replay::CHECKPOINT_INTERVAL) {
+                targets.insert(targets.end(), {checkpoint + 1, checkpoint, checkpoint - 1});
+            }
+            for (int i = 0; i < 8; i++) {
+                targets.push_back(static_cast<int>(random.nextBelow(moves + 1)));
+            }
+
+            ReplayEngine stepped(*replay);
+            for (int target: targets) {
+                if (target < 0 || target > moves) {
+                    continue;
+                }
+                engine.seek(target);
+                stepped.seek(0);
+                while (stepped.getPosition() < target) {
+                    stepped.step();
+                }
+                CHECK(engine.getPosition() == target);
+                CHECK(isSameBoard(engine.getBoard(), stepped.getBoard()));
+            }
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+void testReplayRejectsCorruption() {
+    std::string path = getTemporaryPath("minesweeper_tests.msrep");
+    Board board(30, 16, 99);
+    BoardGenerator().generate(board, 25);
+    Replay recorded(board);
+    Random random(25);
+    playRecordedGame(board, recorded, random, Replay::CHECKPOINT_INTERVAL + 10);
+    CHECK(recorded.save(path));
+
+    std::ifstream in(path, std::ios::binary);
+    std::vector<char> bytes{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    in.close();
+    auto write = [&](const std::vector<char> &contents) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    };
+
+    for (std::size_t i = 0; i < bytes.size(); i += 5) {
+        std::vector<char> corrupt = bytes;
+        corrupt[i] ^= 0x04;
+        write(corrupt);
+        CHECK(!Replay::load(path).has_value());
+    }
+    write({bytes.begin(), bytes.end() - 1});
+    CHECK(!Replay::load(path).has_value());
+    write(bytes);
+    CHECK(Replay::load(path).has_value());
+    std::filesystem::remove(path);
+}
+
+struct Test {
+    const char *name;
+    void (*run)();
+};
+
+constexpr Test TESTS[] = {
+        {"random/reproducible",     testRandomIsReproducible},
+        {"random/nextBelow",        testNextBelowIsUniform},
+        {"placement/reproducible",  testPlacementIsReproducible},
+        {"placement/uniform",       testPlacementIsUniform},
+        {"adjacency/kernels",       testAdjacencyKernelsMatchReference},
+        {"generation/tiled",        testTiledGenerationMatchesSerial},
+        {"generation/bands",        testBandMineCountsAreHypergeometric},
+        {"reveal/flood-fill",       testFloodFillMatchesBreadthFirstSearch},
+        {"opening/dense",           testOpeningMovesMinesConsistently},
+        {"topology/tables",         testTopologyTablesMatchHandWrittenNeighbours},
+        {"solver/one-two-one",      testSolverFindsOneTwoOne},
+        {"solver/sound",            testSolverDeductionsAreSound},
+        {"solver/reset",            testSolverResetMatchesFreshSolver},
+        {"solver/no-guess",         testNoGuessBoardsAreSolvedWithoutGuessing},
+        {"prefetcher/stale",        testPrefetcherDropsStaleBoards},
+        {"probability/corner",      testProbabilitiesOfCornerOne},
+        {"probability/enumeration", testProbabilitiesMatchEnumeration},
+        {"probability/budget",      testProbabilitiesGiveUpOnLongSearches},
+        {"snapshot/round-trip",     testSnapshotRoundTrip},
+        {"snapshot/corruption",     testSnapshotRejectsCorruption},
+        {"infinite/adjacency",      testInfiniteBoardCountsAcrossChunks},
+        {"infinite/eviction",       testInfiniteBoardRebuildsEvictedChunks},
+        {"replay/playback",         testReplayPlaysBack},
+        {"replay/corruption",       testReplayRejectsCorruption}
+};
+
+}
+
+/**
+ * @function main
+ * @brief Entry point of the engine tests.
+ *
+ * @param argc The number of command-line arguments.
+ * @param argv The command-line arguments: optionally a filter on the test names.
+ * @return The number of failed tests.
+ */
+int main(int argc, char *argv[]) {
+    const char *filter = argc > 1 ? argv[1] : "";
+    int failedTests = 0;
+
+    for (const Test &test: TESTS) {
+        if (!std::strstr(test.name, filter)) {
+            continue;
+        }
+
+        failedChecks = 0;
+        test.run();
+        std::printf("%s %s\n", failedChecks == 0 ? "PASS" : "FAIL", test.name);
+        failedTests += failedChecks > 0;
+    }
+
+    return failedTests;
+}
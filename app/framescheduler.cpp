@@ -0,0 +1,137 @@
+/**
+ * @file framescheduler.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the FrameScheduler class, which runs queued tasks in time-budgeted
+ *        slices from a timer on the event loop.
+ */
+
+#include <algorithm>
+#include <utility>
+#include "framescheduler.h"
+#include "trace.h"
+
+/**
+ * @function FrameScheduler
+ * @brief Constructs an idle scheduler that runs slices as soon as the event loop is free.
+ *
+ * @param parent The parent object.
+ */
+FrameScheduler::FrameScheduler(QObject *parent)
+        : QObject(parent), budget(DEFAULT_BUDGET), generation(0) {
+    timer.setInterval(0);
+    connect(&timer, &QTimer::timeout, this, &FrameScheduler::runSlice);
+}
+
+/**
+ * @function ~FrameScheduler
+ * @brief Destructor for FrameScheduler.
+ *
+ * Tasks that have not finished are dropped.
+ */
+FrameScheduler::~FrameScheduler() = default;
+
+/**
+ * @function post
+ * @brief Queues a task behind the ones already queued.
+ *
+ * @param task The task, called with the deadline of the current tick until it returns true.
+ */
+void FrameScheduler::post(Task task) {
+    tasks.push_back(std::move(task));
+    if (!timer.isActive()) {
+        timer.start();
+    }
+}
+
+/**
+ * @function flush
+ * @brief Runs every queued task to completion right away.
+ *
+ * Used before anything that needs the results of the queued work, such as a hint.
+ */
+void FrameScheduler::flush() {
+    TRACE_SCOPE("FrameScheduler::flush");
+    QDeadlineTimer never(QDeadlineTimer::Forever);
+
+    while (!tasks.empty()) {
+        Task task = std::move(tasks.front());
+        tasks.pop_front();
+        std::uint64_t started = generation;
+        if (!task(never) && generation == started) {
+            tasks.push_front(std::move(task));
+        }
+    }
+    timer.stop();
+}
+
+/**
+ * @function cancel
+ * @brief Drops every queued task, including the one that is running, if any.
+ */
+void FrameScheduler::cancel() {
+    tasks.clear();
+    generation++;
+    timer.stop();
+}
+
+/**
+ * @function isIdle
+ * @brief Checks whether there is no work left.
+ *
+ * @return True if no task is queued.
+ */
+bool FrameScheduler::isIdle() const {
+    return tasks.empty();
+}
+
+/**
+ * @function setBudget
+ * @brief Sets how long a tick may run tasks before it returns to the event loop.
+ *
+ * @param milliseconds The budget, at least 1.
+ */
+void FrameScheduler::setBudget(int milliseconds) {
+    budget = std::max(1, milliseconds);
+}
+
+/**
+ * @function setPaced
+ * @brief Chooses between ticking once per frame and ticking whenever the event loop is idle.
+ *
+ * @param paced True to tick every FRAME_INTERVAL milliseconds, false to tick as often as possible.
+ */
+void FrameScheduler::setPaced(bool paced) {
+    timer.setInterval(paced ? FRAME_INTERVAL : 0);
+}
+
+/**
+ * @function runSlice
+ * @brief Runs tasks until the budget of the tick is spent or a task yields.
+ *
+ * The task is taken off the queue while it runs, so it may post or cancel tasks itself.
+ */
+void FrameScheduler::runSlice() {
+    TRACE_SCOPE("FrameScheduler::runSlice");
+    QDeadlineTimer deadline(budget);
+
+    while (!tasks.empty()) {
+        Task task = std::move(tasks.front());
+        tasks.pop_front();
+        std::uint64_t started = generation;
+
+        if (!task(deadline)) {
+            if (generation == started) {
+                tasks.push_front(std::move(task));
+            }
+            break;
+        }
+        if (deadline.hasExpired()) {
+            break;
+        }
+    }
+
+    if (tasks.empty()) {
+        timer.stop();
+    }
+}
@@ -0,0 +1,66 @@
+/**
+ * @file framescheduler.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the FrameScheduler class, which runs long jobs on the Qt event loop in slices.
+ *
+ * A task is a function that does a slice of its work and returns true once it has finished. The
+ * scheduler runs the queued tasks in order from a timer, for at most a time budget per tick, and
+ * then returns to the event loop so input and repaints are handled between slices. A task that
+ * returns false before the deadline yields the rest of the tick, which is how a task paces itself,
+ * for example to animate one step per frame. Everything runs on the thread the scheduler lives on.
+ */
+
+#ifndef QT_MINESWEEPER_FRAMESCHEDULER_H
+#define QT_MINESWEEPER_FRAMESCHEDULER_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <QDeadlineTimer>
+#include <QObject>
+#include <QTimer>
+
+class FrameScheduler : public QObject {
+Q_OBJECT
+
+public:
+
+    using Task = std::function<bool(const QDeadlineTimer &deadline)>;
+
+    static constexpr int DEFAULT_BUDGET = 8; // Milliseconds of work per tick, half a frame at 60 Hz
+    static constexpr int FRAME_INTERVAL = 16; // Milliseconds between ticks when paced to the frame rate
+
+    explicit FrameScheduler(QObject *parent = nullptr);
+
+    ~FrameScheduler() override;
+
+    FrameScheduler(const FrameScheduler &) = delete;
+
+    FrameScheduler &operator=(const FrameScheduler &) = delete;
+
+    void post(Task task);
+
+    void flush();
+
+    void cancel();
+
+    bool isIdle() const;
+
+    void setBudget(int milliseconds);
+
+    void setPaced(bool paced);
+
+private slots:
+
+    void runSlice();
+
+private:
+
+    std::deque<Task> tasks;
+    QTimer timer;
+    int budget; // Milliseconds of work per tick
+    std::uint64_t generation; // Bumped by cancel(), so a running task knows it was dropped
+};
+
+#endif //QT_MINESWEEPER_FRAMESCHEDULER_H
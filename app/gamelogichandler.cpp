@@ -6,203 +6,628 @@
  *        initializing the game board, handling game restarts, and revealing tiles.
  */
 
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <QDebug>
 #include "gamelogichandler.h"
+#include "snapshot.h"
+#include "trace.h"
 
 /**
  * @function GameLogicHandler
  * @brief Constructor for GameLogicHandler.
  *
- * Initializes the game grid and connects the tile revealed signal to the appropriate slot.
- * Calls initializeGame() to set up the board.
+ * Creates the board and starts the first game with startGame(), so it is recorded like every later
+ * one. The seeds of all games are drawn from a generator that is itself seeded from
+ * std::random_device, so two games started within the same second still get different boards. Large
+ * boards are generated on the global thread pool, and the boards of the next games are generated in
+ * the background while the current one is played.
  *
- * @param parent The parent widget, which is passed to each tile.
+ * @param config The size and mine count of the board. Must be valid.
+ * @param parent The parent object.
  */
-GameLogicHandler::GameLogicHandler(QWidget *parent) {
-    // Perform onetime initialization of tiles
-    for (int x = 0; x < GRID_WIDTH; x++) {
-        for (int y = 0; y < GRID_HEIGHT; y++) {
-            tiles[x][y] = new Tile(parent, x, y);
-            connect(tiles[x][y], &Tile::tileRevealed, this, &GameLogicHandler::onTileRevealed);
-        }
-    }
-
-    initializeGame();
+GameLogicHandler::GameLogicHandler(const BoardConfig &config, QObject *parent)
+        : QObject(parent), board(config.width, config.height, config.mineCount, config.topology), solver(board),
+          probabilityEngine(&ThreadPool::global()), probabilityOverlay(false), probabilityRequest(0),
+          generator(&ThreadPool::global()),
+          noGuessGenerator(&ThreadPool::global()), noGuess(false),
+          seedSource((static_cast<std::uint64_t>(std::random_device{}()) << 32) | std::random_device{}()),
+          animated(false), prefetcher(seedSource.next(), PREFETCHED_BOARDS) {
+    startGame(seedSource.next());
+    configurePrefetcher();
 }
 
 /**
  * @function ~GameLogicHandler
  * @brief Destructor for GameLogicHandler.
  *
- * Cleans up resources when the GameLogicHandler instance is destroyed.
+ * The board is a value member, so there is nothing to clean up explicitly.
  */
-GameLogicHandler::~GameLogicHandler() {
-    // Delete all tiles
-    for (int x = 0; x < GRID_WIDTH; x++) {
-        for (int y = 0; y < GRID_HEIGHT; y++) {
-            delete tiles[x][y];
-        }
+GameLogicHandler::~GameLogicHandler() = default;
+
+/**
+ * @function getBoard
+ * @brief Gets the board holding the state of the current game.
+ *
+ * @return The board of the current game.
+ */
+const Board &GameLogicHandler::getBoard() const {
+    return board;
+}
+
+/**
+ * @function getConfig
+ * @brief Gets the size, mine count and topology of the current board.
+ *
+ * @return The configuration of the current board.
+ */
+BoardConfig GameLogicHandler::getConfig() const {
+    return {board.getWidth(), board.getHeight(), board.getMineCount(), board.getTopology()};
+}
+
+/**
+ * @function setConfig
+ * @brief Replaces the board with one of a different size or mine count and starts a new game.
+ *
+ * Invalid configurations are ignored. Boards generated in the background for the old configuration
+ * are dropped.
+ *
+ * @param config The new size and mine count of the board.
+ */
+void GameLogicHandler::setConfig(const BoardConfig &config) {
+    if (!config.isValid()) {
+        qDebug() << "Invalid board configuration: " << config.width << "x" << config.height << ", "
+                 << config.mineCount << " mines";
+        return;
     }
-};
+
+    board = Board(config.width, config.height, config.mineCount, config.topology);
+    configurePrefetcher();
+    restartGame();
+}
 
 /**
- * @function getTile
- * @brief Gets the tile at the specified location.
+ * @function saveGame
+ * @brief Saves the current game as a Snapshot.
  *
- * @param x The x-coordinate of the tile.
- * @param y The y-coordinate of the tile.
- * @return The tile at the specified location.
+ * @param path The path of the file.
+ * @return True if the file was written.
  */
-Tile *GameLogicHandler::getTile(int x, int y) {
-    if (x >= 0 && x < GRID_WIDTH && y >= 0 && y < GRID_HEIGHT) {
-        return tiles[x][y];
-    } else {
-        qDebug() << "Invalid tile location: (" << x << ", " << y << ")";
-        return nullptr;
+bool GameLogicHandler::saveGame(const std::string &path) const {
+    return Snapshot::save(board, path);
+}
+
+/**
+ * @function loadGame
+ * @brief Replaces the current game with one saved by saveGame().
+ *
+ * The board takes the size and state of the saved game, and the next games are generated with its
+ * size. A saved game that is already over stays over until the game is restarted. The board view
+ * only draws rectangular boards, so a snapshot of a torus or hexagonal board leaves the current
+ * game as it is.
+ *
+ * @param path The path of the file.
+ * @return LOADED if the game was loaded, INVALID if the file is not a valid snapshot, or
+ *         UNSUPPORTED if its board is not rectangular.
+ */
+GameLogicHandler::LoadResult GameLogicHandler::loadGame(const std::string &path) {
+    std::unique_ptr<Snapshot> snapshot = Snapshot::open(path);
+    if (!snapshot) {
+        return LoadResult::INVALID;
+    }
+    if (snapshot->getTopology() != Topology::Kind::RECTANGLE) {
+        return LoadResult::UNSUPPORTED;
+    }
+
+    bool resized = snapshot->getWidth() != board.getWidth() || snapshot->getHeight() != board.getHeight() ||
+                   snapshot->getMineCount() != board.getMineCount() || snapshot->getTopology() != board.getTopology();
+    board = snapshot->toBoard();
+    if (resized) {
+        configurePrefetcher();
     }
+    replay.reset(); // The board cannot be generated again from its seed
+    beginGame();
+    return LoadResult::LOADED;
+}
+
+/**
+ * @function saveReplay
+ * @brief Saves the moves of the current game so far as a Replay.
+ *
+ * @param path The path of the file.
+ * @return True if the file was written, false if it could not be or the game was loaded from a
+ *         snapshot and has no replay.
+ */
+bool GameLogicHandler::saveReplay(const std::string &path) const {
+    return replay && replay->save(path);
 }
 
 /**
  * @function restartGame
  * @brief Restarts the game.
  *
- * Resets all tiles and reinitializes the game board.
+ * Starts a new game on a board generated in the background, so restarting takes the same time
+ * however long the board took to generate. If no board is ready yet, one is generated on the spot
+ * from a fresh seed.
  */
 void GameLogicHandler::restartGame() {
-    // Reset all tiles
-    for (int x = 0; x < GRID_WIDTH; x++) {
-        for (int y = 0; y < GRID_HEIGHT; y++) {
-            tiles[x][y]->reset();
-        }
+    TRACE_SCOPE("GameLogicHandler::restartGame");
+    if (std::optional<Board> next = prefetcher.take()) {
+        board = std::move(*next);
+        replay.emplace(board);
+        beginGame();
+        return;
     }
 
-    initializeGame();
+    startGame(seedSource.next());
+}
+
+/**
+ * @function startGame
+ * @brief Starts a new game from the given seed.
+ *
+ * Resets the board, reinitializes it and tells the view to redraw everything. Starting a game
+ * twice with the same seed reproduces the same board.
+ *
+ * @param seed The seed the mine layout is derived from.
+ */
+void GameLogicHandler::startGame(quint64 seed) {
+    TRACE_SCOPE("GameLogicHandler::startGame");
+    board.reset();
+    initializeGame(seed);
+    replay.emplace(board);
+    beginGame();
 }
 
 /**
  * @function initializeGame
  * @brief Initializes the game state.
  *
- * Sets the initial state of the game, including the number of non-bomb tiles and resetting the revealed tiles counter.
- * Also calls methods to place mines and calculate adjacent mines.
+ * Places the mines on the (freshly reset) board and calculates the adjacent mines of every cell.
+ * In no-guess mode the board is searched for a layout that can be solved from the centre cell
+ * without guessing, and the centre cell is revealed so the game starts from there. If the board is
+ * too dense for such a layout to be found, a regular board is generated instead.
+ *
+ * @param seed The seed the mine layout is derived from.
  */
-void GameLogicHandler::initializeGame() {
-    totalNonBombTiles = GRID_WIDTH * GRID_HEIGHT - NUMBER_OF_MINES;
-    revealedNonBombTiles = 0;
+void GameLogicHandler::initializeGame(std::uint64_t seed) {
+    generateBoard(board, seed, noGuess);
+}
 
-    initializeBombLocations();
-    calculateAdjacentMines();
+/**
+ * @function generateBoard
+ * @brief Fills a reset board the way initializeGame() describes.
+ *
+ * Only reads the generators, so it is safe to call from the prefetcher's worker thread.
+ *
+ * @param board The board to fill.
+ * @param seed The seed the mine layout is derived from.
+ * @param noGuess True to generate a board that can be solved without guessing.
+ * @param stop Cancels the search for a no-guess board.
+ * @return True if the board was generated, false if it was cancelled.
+ */
+bool GameLogicHandler::generateBoard(Board &board, std::uint64_t seed, bool noGuess, std::stop_token stop) const {
+    int startX = board.getWidth() / 2;
+    int startY = board.getHeight() / 2;
+
+    if (noGuess) {
+        if (noGuessGenerator.generate(board, seed, startX, startY, stop)) {
+            board.reveal(startX, startY);
+            return true;
+        }
+        if (stop.stop_requested()) {
+            return false;
+        }
+    }
+
+    generator.generate(board, seed);
+    return true;
+}
+
+/**
+ * @function configurePrefetcher
+ * @brief Tells the prefetcher to generate boards for the current size and settings.
+ */
+void GameLogicHandler::configurePrefetcher() {
+    // The flag is copied, so the worker thread never reads it while the GUI thread changes it
+    prefetcher.configure(getConfig(),
+                         [this, noGuess = noGuess](Board &board, std::uint64_t seed, std::stop_token stop) {
+                             return generateBoard(board, seed, noGuess, stop);
+                         });
 }
 
 /**
- * @function initializeBombLocations
- * @brief Initializes bomb locations randomly on the grid.
+ * @function beginGame
+ * @brief Brings the solver, the view and the overlay up to date with a new board.
  *
- * This function randomly places mines on the game grid until the number of mines specified by
- * NUMBER_OF_MINES is reached. It ensures that each tile can only have one mine.
+ * Cells of the previous game that have not reached the view yet are dropped.
  */
-void GameLogicHandler::initializeBombLocations() {
-    std::srand(std::time(0)); // Seeding the random number generator with the time
-    int placedMines = 0;
+void GameLogicHandler::beginGame() {
+    scheduler.cancel();
+    solver.reset();
+    gameClock.start();
 
-    while (placedMines < NUMBER_OF_MINES) {
-        int x = std::rand() % GRID_WIDTH;
-        int y = std::rand() % GRID_HEIGHT;
+    emit boardReset();
+    if (probabilityOverlay) {
+        emit probabilitiesChanged(nullptr); // The overlay of the previous game does not apply to this one
+    }
+    updateProbabilities();
+}
 
-        // Check if there's already a mine at this location
-        if (!tiles[x][y]->isMine()) {
-            tiles[x][y]->setMine(true);
-            placedMines++;
-        }
+/**
+ * @function revealCell
+ * @brief Slot to handle when the player asks to reveal a cell.
+ *
+ * The first cell revealed in a game is always safe, because the board moves the mines out of its
+ * neighbourhood before opening it. The board opens the cell together with its whole opening in a
+ * single flood fill, and finishMove() handles the result.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ */
+void GameLogicHandler::revealCell(int x, int y) {
+    TRACE_SCOPE("GameLogicHandler::revealCell");
+    if (board.isLost() || board.isWon() || board.isRevealed(x, y)) {
+        return;
     }
+
+    changedCells.clear();
+    Board::RevealResult result = board.reveal(x, y, &changedCells);
+    recordMove(Replay::MoveType::REVEAL, y * board.getWidth() + x);
+    finishMove(result);
 }
 
 /**
- * @function calculateAdjacentMines
- * @brief Calculates the number of adjacent mines for each tile.
+ * @function markCell
+ * @brief Slot to handle when the player asks to change the mark of a cell.
+ *
+ * Cycles the mark of a hidden cell on the board, records the move and tells the view to redraw it.
  *
- * Iterates over each tile on the grid and counts the number of adjacent mines. This count is then
- * set on the tile for game logic and display purposes.
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
  */
-void GameLogicHandler::calculateAdjacentMines() {
-    for (int x = 0; x < GRID_WIDTH; x++) {
-        for (int y = 0; y < GRID_HEIGHT; y++) {
-            // Skip this tile if it is a mine
-            if (tiles[x][y]->isMine()) continue;
+void GameLogicHandler::markCell(int x, int y) {
+    if (board.isLost() || board.isWon() || board.isRevealed(x, y)) {
+        return; // Revealed cells cannot be marked, so the replay gets no move that changes nothing
+    }
 
-            int mineCount = 0;
+    board.cycleMark(x, y);
+    recordMove(Replay::MoveType::CYCLE_MARK, y * board.getWidth() + x);
 
-            // Check all adjacent tiles
-            for (int i = -1; i <= 1; i++) {
-                for (int j = -1; j <= 1; j++) {
-                    int nx = x + i;
-                    int ny = y + j;
+    changedCells.assign(1, y * board.getWidth() + x);
+    emit cellsChanged(changedCells);
+}
 
-                    // Check if the adjacent tile is within the grid bounds
-                    if (nx >= 0 && nx < GRID_WIDTH && ny >= 0 && ny < GRID_HEIGHT) {
-                        // Increment count if the adjacent tile is a mine
-                        if (tiles[nx][ny]->isMine()) {
-                            mineCount++;
-                        }
-                    }
-                }
-            }
+/**
+ * @function chordCell
+ * @brief Slot to handle when the player asks to chord on a revealed number.
+ *
+ * If as many neighbours of the cell are flagged as its number says, the board reveals all of its
+ * other hidden neighbours at once. A wrong flag makes this lose the game like any other reveal.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ */
+void GameLogicHandler::chordCell(int x, int y) {
+    TRACE_SCOPE("GameLogicHandler::chordCell");
+    if (board.isLost() || board.isWon()) {
+        return;
+    }
+
+    changedCells.clear();
+    Board::RevealResult result = board.chord(x, y, &changedCells);
+    recordMove(Replay::MoveType::CHORD, y * board.getWidth() + x);
+    finishMove(result);
+}
+
+/**
+ * @function recordMove
+ * @brief Adds a move that has just been applied to the board to the replay of the game.
+ *
+ * Called before finishMove(), which may reveal the whole board after a loss.
+ *
+ * @param type The kind of move.
+ * @param cell The board index of the cell the move was made on.
+ */
+void GameLogicHandler::recordMove(Replay::MoveType type, int cell) {
+    if (replay) {
+        replay->record(board, {type, cell, static_cast<std::uint32_t>(gameClock.elapsed())});
+    }
+}
 
-            // Set the count of adjacent mines
-            tiles[x][y]->setAdjacentMines(mineCount);
+/**
+ * @function finishMove
+ * @brief Ends a move that revealed the cells in changedCells.
+ *
+ * If the move hit a mine, this function reveals the whole board and emits a gameOver signal with a
+ * loss once the view has shown it. If not, the batch of newly revealed cells is sent to the solver
+ * and to the view, and once both have it the overlay is updated and a win is reported.
+ *
+ * @param result The result of the reveal.
+ */
+void GameLogicHandler::finishMove(Board::RevealResult result) {
+    if (result == Board::RevealResult::MINE) {
+        // Player stepped on a mine, reveal all cells and end game as loss
+        if (animated) {
+            // The cells of the move, with the exploded mine, come first
+            std::vector<int> remainingCells = revealRemainingCells();
+            changedCells.insert(changedCells.end(), remainingCells.begin(), remainingCells.end());
+            presentCells(changedCells, false);
+        } else {
+            // Showing the whole board takes constant time, so only the visible cells are repainted
+            board.revealAll();
+            emit boardReset();
         }
+        scheduler.post([this](const QDeadlineTimer &) {
+            emit gameOver(false); // Emit loss
+            return true;
+        });
+        return;
     }
+    if (result == Board::RevealResult::IGNORED) {
+        return;
+    }
+    presentCells(changedCells, true);
+
+    // Check if the player has won by revealing all non-bomb cells; later moves may follow before
+    // this batch is shown, so the answer is taken now
+    bool won = board.isWon();
+    scheduler.post([this, won](const QDeadlineTimer &) {
+        updateProbabilities();
+        if (won) {
+            emit gameOver(true); // Emit win
+        }
+        return true;
+    });
 }
 
 /**
- * @function onTileRevealed
- * @brief Slot to handle when a tile is revealed.
+ * @function revealRemainingCells
+ * @brief Reveals the whole board after a loss and lists the cells for the animation.
  *
- * When a tile is revealed, this function checks if the tile is a mine. If so, it reveals all tiles
- * and emits a gameOver signal with a loss. If not, it increments the count of revealed non-bomb tiles
- * and checks if the player has won.
+ * The cells are ordered by their distance to the mine that exploded, so the board is uncovered in
+ * a wave spreading from it.
  *
- * @param tile The tile that was revealed.
- * @param steppedOnMine Indicates whether the revealed tile was a mine.
+ * @return The board indices of the cells that were hidden until now.
  */
-void GameLogicHandler::onTileRevealed(Tile *tile, bool steppedOnMine) {
-    if (steppedOnMine) {
-        // Player stepped on a mine, reveal all tiles and end game as loss
-        for (int x = 0; x < GRID_WIDTH; x++) {
-            for (int y = 0; y < GRID_HEIGHT; y++) {
-                if (!tiles[x][y]->isRevealed()) {
-                    tiles[x][y]->reveal(true);
-                }
+std::vector<int> GameLogicHandler::revealRemainingCells() {
+    TRACE_SCOPE("GameLogicHandler::revealRemainingCells");
+    int width = board.getWidth();
+    int height = board.getHeight();
+    int explodedX = 0, explodedY = 0;
+    std::vector<int> cells;
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (board.isExploded(x, y)) {
+                explodedX = x;
+                explodedY = y;
+            }
+            if (!board.isRevealed(x, y)) {
+                cells.push_back(y * width + x);
             }
         }
+    }
+    board.revealAll();
 
-        emit gameOver(false); // Emit loss
-    } else {
-        // Player did not step on a mine, reveal adjacent tiles if there are no adjacent mines
-        // This algorithm ends up being pseudo-recursive, since it calls reveal on tile, which
-        // calls this slot again which calls reveal on adjacent tiles, and so on, etc.
-        if (tile->getAdjacentMines() == 0) {
-            for (int i = -1; i <= 1; i++) {
-                for (int j = -1; j <= 1; j++) {
-                    int nx = tile->getI() + i;
-                    int ny = tile->getJ() + j;
-
-                    // Check if the adjacent tile is within the grid bounds
-                    if (nx >= 0 && nx < GRID_WIDTH && ny >= 0 && ny < GRID_HEIGHT) {
-                        // Reveal the adjacent tile if it is not already revealed
-                        if (!tiles[nx][ny]->isRevealed()) {
-                            tiles[nx][ny]->reveal(false);
-                        }
-                    }
-                }
+    // Counting sort on the distance in moves of a king, which is at most the larger side
+    auto distance = [&](int cell) {
+        return std::max(std::abs(cell % width - explodedX), std::abs(cell / width - explodedY));
+    };
+    std::vector<int> starts(std::max(width, height) + 1, 0);
+    for (int cell: cells) {
+        starts[distance(cell) + 1]++;
+    }
+    for (std::size_t i = 1; i < starts.size(); i++) {
+        starts[i] += starts[i - 1];
+    }
+    std::vector<int> sorted(cells.size());
+    for (int cell: cells) {
+        sorted[starts[distance(cell)]++] = cell;
+    }
+    return sorted;
+}
+
+/**
+ * @function presentCells
+ * @brief Hands a batch of changed cells to the solver and the view, a slice at a time.
+ *
+ * The view is told right away which cells are on their way, so it keeps drawing them as they were
+ * until their slice arrives. The slices are handed over on the event loop within the scheduler's
+ * time budget; with animations on, the batch is also spread over REVEAL_ANIMATION_FRAMES frames.
+ *
+ * @param cells The board indices of the changed cells, in the order they should appear.
+ * @param updateSolver True to feed the cells to the solver as newly revealed cells.
+ */
+void GameLogicHandler::presentCells(std::vector<int> cells, bool updateSolver) {
+    if (cells.empty()) {
+        return;
+    }
+    emit cellsPending(cells);
+
+    std::size_t frameStep = animated ? std::max<std::size_t>(MIN_REVEAL_ANIMATION_STEP,
+                                                             cells.size() / REVEAL_ANIMATION_FRAMES) : cells.size();
+    scheduler.post([this, cells = std::move(cells), updateSolver, frameStep, next = std::size_t(0)](
+            const QDeadlineTimer &deadline) mutable {
+        TRACE_SCOPE("GameLogicHandler::presentCells");
+        std::size_t frameEnd = std::min(cells.size(), next + frameStep);
+
+        while (next < frameEnd) {
+            std::size_t end = std::min(frameEnd, next + REVEAL_SLICE);
+            std::vector<int> slice(cells.begin() + static_cast<std::ptrdiff_t>(next),
+                                   cells.begin() + static_cast<std::ptrdiff_t>(end));
+            if (updateSolver) {
+                solver.update(slice);
+            }
+            emit cellsChanged(slice);
+            next = end;
+
+            if (deadline.hasExpired()) {
+                break;
             }
         }
+        return next == cells.size();
+    });
+}
+
+/**
+ * @function showHint
+ * @brief Slot to handle when the player asks for a hint.
+ *
+ * Emits hintFound with a hidden cell the solver has proven safe, or noHintFound if the revealed
+ * numbers do not prove any hidden cell safe and the player has to guess.
+ */
+void GameLogicHandler::showHint() {
+    if (board.isLost() || board.isWon()) {
+        return;
+    }
+    scheduler.flush();
+
+    int cell = solver.findSafeCell();
+    if (cell < 0) {
+        emit noHintFound();
+        return;
+    }
+
+    emit hintFound(cell % board.getWidth(), cell / board.getWidth());
+}
+
+/**
+ * @function autoSolve
+ * @brief Slot to handle when the player asks the game to play the safe moves.
+ *
+ * Reveals cells the solver has proven safe until none are left, feeding every reveal back to the
+ * solver. All revealed cells are sent to the view as one batch, in slices like any other move.
+ * Stops when the game is won or a guess is needed; in the latter case noHintFound is emitted.
+ */
+void GameLogicHandler::autoSolve() {
+    TRACE_SCOPE("GameLogicHandler::autoSolve");
+    if (board.isLost() || board.isWon()) {
+        return;
+    }
+    scheduler.flush();
+
+    changedCells.clear();
+    std::vector<int> revealedCells;
+    int width = board.getWidth();
 
-        revealedNonBombTiles++; // Increment the count of safe revealed tiles
+    for (int cell = solver.findSafeCell(); cell >= 0 && !board.isWon(); cell = solver.findSafeCell()) {
+        revealedCells.clear();
+        board.reveal(cell % width, cell / width, &revealedCells);
+        recordMove(Replay::MoveType::REVEAL, cell);
+        solver.update(revealedCells);
+        changedCells.insert(changedCells.end(), revealedCells.begin(), revealedCells.end());
+    }
+
+    presentCells(changedCells, false);
 
-        // Check if the player has won by revealing all non-bomb tiles
-        if (revealedNonBombTiles == totalNonBombTiles) {
+    bool won = board.isWon();
+    scheduler.post([this, won](const QDeadlineTimer &) {
+        updateProbabilities();
+        if (won) {
             emit gameOver(true); // Emit win
+        } else {
+            emit noHintFound();
         }
+        return true;
+    });
+}
+
+/**
+ * @function setProbabilityOverlay
+ * @brief Slot to turn the probability overlay on or off.
+ *
+ * While it is on, the probability of every hidden cell being a mine is recomputed after each move
+ * and sent to the view. Turning it off stops the computation that is running and sends no
+ * probabilities, which hides the overlay.
+ *
+ * @param enabled True to show the probabilities, false to hide them.
+ */
+void GameLogicHandler::setProbabilityOverlay(bool enabled) {
+    probabilityOverlay = enabled;
+
+    if (enabled) {
+        updateProbabilities();
+    } else {
+        probabilityWorker = std::jthread();
+        probabilityRequest++;
+        emit probabilitiesChanged(nullptr);
     }
 }
 
+/**
+ * @function updateProbabilities
+ * @brief Starts recomputing the mine probabilities for the view, if the overlay is on.
+ *
+ * The engine runs on a thread of its own over a copy of the board, so a large frontier never
+ * blocks input. The computation of an earlier move is stopped first, and a result is only sent to
+ * the view if no newer computation has been started since. Probabilities that are only an estimate
+ * hide the overlay rather than show it.
+ */
+void GameLogicHandler::updateProbabilities() {
+    TRACE_SCOPE("GameLogicHandler::updateProbabilities");
+    if (!probabilityOverlay) {
+        return;
+    }
+
+    // The engine is not shared, so the previous computation has to return before the next one starts
+    probabilityWorker = std::jthread();
+    std::uint64_t request = ++probabilityRequest;
+    probabilityWorker = std::jthread([this, view = board, request](std::stop_token stop) {
+        std::shared_ptr<const std::vector<double>> probabilities;
+        if (probabilityEngine.compute(view, stop)) {
+            probabilities = std::make_shared<const std::vector<double>>(probabilityEngine.getProbabilities());
+        } else if (stop.stop_requested()) {
+            return;
+        }
+
+        QMetaObject::invokeMethod(this, [this, request, probabilities]() {
+            if (request == probabilityRequest) {
+                emit probabilitiesChanged(probabilities);
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/**
+ * @function setNoGuess
+ * @brief Slot to turn no-guess boards on or off.
+ *
+ * The setting applies from the next game on. Boards generated in the background with the old
+ * setting are dropped.
+ *
+ * @param enabled True to generate boards that can be solved without guessing.
+ */
+void GameLogicHandler::setNoGuess(bool enabled) {
+    if (noGuess == enabled) {
+        return;
+    }
+
+    noGuess = enabled;
+    configurePrefetcher();
+}
+
+/**
+ * @function setAnimated
+ * @brief Slot to turn the reveal animation on or off.
+ *
+ * While it is on, the cells of a move appear over several frames, and the board of a lost game is
+ * uncovered in a wave from the mine that exploded.
+ *
+ * @param enabled True to animate reveals.
+ */
+void GameLogicHandler::setAnimated(bool enabled) {
+    animated = enabled;
+    scheduler.setPaced(enabled);
+}
+
+/**
+ * @function isIdle
+ * @brief Checks whether every move so far has reached the solver and the view.
+ *
+ * @return True if no batch of cells is still being handed over.
+ */
+bool GameLogicHandler::isIdle() const {
+    return scheduler.isIdle();
+}
@@ -4,25 +4,52 @@
  * @date 2024-01-21
  * @brief Defines the GameLogicHandler class that manages the state and logic of the Minesweeper game.
  *
- * GameLogicHandler is a responsible for initializing the game grid with tiles, setting up mines,
- * calculating adjacent mines for each tile, and determining the game's end conditions. It provides
- * the functionality to restart the game and to handle tile reveal actions, emitting signals when
- * the game is over due to a win or a loss.
+ * GameLogicHandler is a responsible for initializing the game board, setting up mines, calculating
+ * adjacent mines for each cell, and determining the game's end conditions. It provides the
+ * functionality to restart the game and to handle reveal and mark requests, emitting signals when
+ * cells change and when the game is over due to a win or a loss. The game state itself lives in a
+ * Board; the BoardView only draws it. A move is applied to the board at once, but the cells it
+ * changed reach the solver and the view in slices on the event loop, so a large cascade or the
+ * reveal of a lost board never blocks input and repaints. The probability overlay is computed on
+ * a thread of its own for the same reason. Every move of a generated game is recorded in a Replay,
+ * which can be saved.
  */
 
 #ifndef QT_MINESWEEPER_GAMELOGICHANDLER_H
 #define QT_MINESWEEPER_GAMELOGICHANDLER_H
 
+#include <QElapsedTimer>
 #include <QObject>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include "board.h"
+#include "boardconfig.h"
+#include "boardgenerator.h"
+#include "boardprefetcher.h"
+#include "noguessgenerator.h"
+#include "probabilityengine.h"
 #include "constants.h"
-#include "tile.h"
+#include "framescheduler.h"
+#include "random.h"
+#include "replay.h"
+#include "solver.h"
 
 class GameLogicHandler : public QObject {
 Q_OBJECT
 
 public:
 
-    explicit GameLogicHandler(QWidget *parent);
+    enum class LoadResult {
+        LOADED,
+        INVALID, // The file is not a valid snapshot
+        UNSUPPORTED // The snapshot is valid, but the board view cannot draw its topology
+    };
+
+    explicit GameLogicHandler(const BoardConfig &config = BoardConfig::expert(), QObject *parent = nullptr);
 
     ~GameLogicHandler() override;
 
@@ -34,31 +61,94 @@ public:
 
     GameLogicHandler &operator=(GameLogicHandler &&) = delete;
 
-    Tile *getTile(int x, int y);
+    const Board &getBoard() const;
+
+    BoardConfig getConfig() const;
+
+    bool saveGame(const std::string &path) const;
+
+    LoadResult loadGame(const std::string &path);
+
+    bool saveReplay(const std::string &path) const;
+
+    bool isIdle() const;
 
 signals:
 
     void gameOver(bool won);
 
+    void cellsChanged(const std::vector<int> &cells);
+
+    void cellsPending(const std::vector<int> &cells);
+
+    void boardReset();
+
+    void hintFound(int x, int y);
+
+    void noHintFound();
+
+    void probabilitiesChanged(std::shared_ptr<const std::vector<double>> probabilities);
+
 public slots:
 
     void restartGame();
 
+    void startGame(quint64 seed);
+
+    void setConfig(const BoardConfig &config);
+
+    void revealCell(int x, int y);
+
+    void markCell(int x, int y);
+
+    void chordCell(int x, int y);
+
+    void showHint();
+
+    void autoSolve();
+
+    void setProbabilityOverlay(bool enabled);
+
+    void setNoGuess(bool enabled);
+
+    void setAnimated(bool enabled);
+
 private:
 
-    void initializeGame();
+    void initializeGame(std::uint64_t seed);
+
+    bool generateBoard(Board &board, std::uint64_t seed, bool noGuess, std::stop_token stop = {}) const;
+
+    void configurePrefetcher();
+
+    void beginGame();
+
+    void recordMove(Replay::MoveType type, int cell);
 
-    void initializeBombLocations();
+    void finishMove(Board::RevealResult result);
 
-    void calculateAdjacentMines();
+    std::vector<int> revealRemainingCells();
 
-    Tile *tiles[GRID_WIDTH][GRID_HEIGHT];
-    int revealedNonBombTiles;
-    int totalNonBombTiles;
+    void presentCells(std::vector<int> cells, bool updateSolver);
 
-private slots:
+    void updateProbabilities();
 
-    void onTileRevealed(Tile *tile, bool steppedOnMine);
+    Board board;
+    Solver solver; // Follows every move, for hints and auto-solve
+    ProbabilityEngine probabilityEngine; // Only used by probabilityWorker
+    bool probabilityOverlay; // Recompute the probabilities after every move
+    std::uint64_t probabilityRequest; // Bumped by every update, so a result that arrives too late is dropped
+    std::jthread probabilityWorker; // Computes the overlay of the latest move; stopped before the engine goes
+    BoardGenerator generator;
+    NoGuessGenerator noGuessGenerator;
+    bool noGuess; // Generate boards that can be solved without guessing
+    Random seedSource; // Draws the seed of every new game
+    std::vector<int> changedCells; // Batch of cells changed by the last move, reused across moves
+    FrameScheduler scheduler; // Feeds large batches to the solver and the view a slice at a time
+    bool animated; // Show the cells of a batch over several frames
+    std::optional<Replay> replay; // Moves of the current game, empty for a game that was loaded
+    QElapsedTimer gameClock; // Started when the current game began, for the times in the replay
+    BoardPrefetcher prefetcher; // Uses the generators, so it is declared after them and stopped first
 
 };
 
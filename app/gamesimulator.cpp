@@ -0,0 +1,297 @@
+/**
+ * @file gamesimulator.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the GameSimulator class, which plays numbered games in parallel chunks
+ *        and collects the statistics of every strategy.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include "boardgenerator.h"
+#include "gamesimulator.h"
+#include "noguessgenerator.h"
+#include "random.h"
+#include "snapshot.h"
+
+namespace {
+
+// Index of the bucket that holds the given share of all counted values
+int findPercentile(const std::vector<long long> &counts, double percentile) {
+    long long total = 0;
+    for (long long count: counts) {
+        total += count;
+    }
+
+    auto target = std::max(1LL, static_cast<long long>(percentile / 100.0 * static_cast<double>(total) + 0.5));
+    long long seen = 0;
+    for (std::size_t i = 0; i < counts.size(); i++) {
+        seen += counts[i];
+        if (seen >= target) {
+            return static_cast<int>(i);
+        }
+    }
+    return counts.empty() ? 0 : static_cast<int>(counts.size() - 1);
+}
+
+Replay::MoveType toMoveType(Action::Type type) {
+    switch (type) {
+        case Action::Type::FLAG:
+            return Replay::MoveType::FLAG;
+        case Action::Type::CHORD:
+            return Replay::MoveType::CHORD;
+        default:
+            return Replay::MoveType::REVEAL;
+    }
+}
+
+void addCounts(std::vector<long long> &counts, const std::vector<long long> &other) {
+    if (counts.size() < other.size()) {
+        counts.resize(other.size(), 0);
+    }
+    for (std::size_t i = 0; i < other.size(); i++) {
+        counts[i] += other[i];
+    }
+}
+
+}
+
+/**
+ * @function add
+ * @brief Adds the result of one game.
+ *
+ * @param result The result of the game.
+ */
+void GameSimulator::Statistics::add(const GameResult &result) {
+    games++;
+    wins += result.won;
+    moves += result.moves;
+
+    if (static_cast<int>(moveCounts.size()) <= result.moves) {
+        moveCounts.resize(result.moves + 1, 0);
+    }
+    moveCounts[result.moves]++;
+}
+
+/**
+ * @function addLatency
+ * @brief Records how long a strategy took to decide on one action.
+ *
+ * Latencies from 16 ns on share a bucket with the latencies that have the same highest bit and
+ * the same four bits below it, so every bucket is at most 1/16 wide.
+ *
+ * @param nanoseconds The decision time.
+ */
+void GameSimulator::Statistics::addLatency(long long nanoseconds) {
+    auto value = static_cast<std::uint64_t>(std::max(0LL, nanoseconds));
+    int bucket = static_cast<int>(value);
+
+    if (value >= LATENCY_SUB_BUCKETS) {
+        int exponent = std::bit_width(value) - 1; // At least 4
+        int fraction = static_cast<int>(value >> (exponent - 4)) & (LATENCY_SUB_BUCKETS - 1);
+        bucket = LATENCY_SUB_BUCKETS + (exponent - 4) * LATENCY_SUB_BUCKETS + fraction;
+    }
+
+    if (static_cast<int>(latencyCounts.size()) <= bucket) {
+        latencyCounts.resize(bucket + 1, 0);
+    }
+    latencyCounts[bucket]++;
+}
+
+/**
+ * @function merge
+ * @brief Adds the statistics of another set of games.
+ *
+ * @param other The statistics to add.
+ */
+void GameSimulator::Statistics::merge(const Statistics &other) {
+    games += other.games;
+    wins += other.wins;
+    moves += other.moves;
+    addCounts(moveCounts, other.moveCounts);
+    addCounts(latencyCounts, other.latencyCounts);
+}
+
+/**
+ * @function getMovePercentile
+ * @brief Returns the number of moves that the given share of the games did not exceed.
+ *
+ * @param percentile The share of the games, in [0, 100].
+ * @return The smallest move count n such that at least that share of the games took n moves or
+ *         fewer, or 0 if no game was played.
+ */
+int GameSimulator::Statistics::getMovePercentile(double percentile) const {
+    return findPercentile(moveCounts, percentile);
+}
+
+/**
+ * @function getLatencyPercentile
+ * @brief Returns the decision time that the given share of the actions did not exceed.
+ *
+ * @param percentile The share of the actions, in [0, 100].
+ * @return The upper end of the latency bucket in nanoseconds, or 0 if no action was recorded.
+ */
+long long GameSimulator::Statistics::getLatencyPercentile(double percentile) const {
+    int bucket = findPercentile(latencyCounts, percentile);
+    if (bucket < LATENCY_SUB_BUCKETS) {
+        return bucket;
+    }
+
+    int exponent = (bucket - LATENCY_SUB_BUCKETS) / LATENCY_SUB_BUCKETS + 4;
+    int fraction = (bucket - LATENCY_SUB_BUCKETS) % LATENCY_SUB_BUCKETS;
+    return ((static_cast<long long>(LATENCY_SUB_BUCKETS + fraction + 1) << (exponent - 4))) - 1;
+}
+
+/**
+ * @function GameSimulator
+ * @brief Constructs a GameSimulator.
+ *
+ * @param pool The pool the games are played on, or nullptr to play them on the calling thread.
+ *             The win and move statistics do not depend on it.
+ */
+GameSimulator::GameSimulator(ThreadPool *pool) : pool(pool) {}
+
+/**
+ * @function ~GameSimulator
+ * @brief Destructor for GameSimulator.
+ *
+ * The pool is not owned by the simulator.
+ */
+GameSimulator::~GameSimulator() = default;
+
+/**
+ * @function run
+ * @brief Lets every strategy play the same games and returns the statistics of each.
+ *
+ * Game i is played on the board generated from the seed Random::mix(seed) + i, and every strategy
+ * gets the same seed for its own random choices in that game, so two runs with the same arguments
+ * give the same results (apart from the latencies).
+ *
+ * @param config The size and mine count of the boards. Must be valid.
+ * @param strategies The names of the strategies. They must be known to Strategy::create().
+ * @param games The number of games every strategy plays.
+ * @param seed The seed the boards and random choices are derived from.
+ * @param noGuess True to play boards that can be solved without guessing from the centre cell.
+ * @param archive The directory the final board of every lost game is saved to as a Snapshot, named
+ *                game-<number>-<strategy>.msnap, or empty to save none.
+ * @param replays The directory every game is saved to as a Replay, named
+ *                game-<number>-<strategy>.msrep, or empty to save none.
+ * @return The statistics of every strategy, in the order of the names.
+ */
+std::vector<GameSimulator::Statistics> GameSimulator::run(const BoardConfig &config,
+                                                          const std::vector<std::string> &strategies,
+                                                          long long games, std::uint64_t seed, bool noGuess,
+                                                          const std::string &archive,
+                                                          const std::string &replays) const {
+    auto chunkCount = static_cast<int>((games + CHUNK_GAMES - 1) / CHUNK_GAMES);
+    std::vector<Statistics> totals(strategies.size());
+    std::mutex totalsMutex;
+
+    auto playChunk = [&](int chunk) {
+        BoardGenerator generator;
+        NoGuessGenerator noGuessGenerator;
+        Board board(config.width, config.height, config.mineCount, config.topology);
+        Board copy = board;
+
+        std::vector<std::unique_ptr<Strategy>> players;
+        for (const std::string &name: strategies) {
+            players.push_back(Strategy::create(name));
+        }
+        std::vector<Statistics> statistics(strategies.size());
+
+        long long first = static_cast<long long>(chunk) * CHUNK_GAMES;
+        long long end = std::min(games, first + CHUNK_GAMES);
+        for (long long game = first; game < end; game++) {
+            std::uint64_t gameSeed = Random::mix(seed) + static_cast<std::uint64_t>(game);
+            int startX = config.width / 2;
+            int startY = config.height / 2;
+
+            board.reset();
+            if (noGuess && noGuessGenerator.generate(board, gameSeed, startX, startY)) {
+                board.reveal(startX, startY);
+            } else {
+                generator.generate(board, gameSeed);
+            }
+
+            for (std::size_t i = 0; i < players.size(); i++) {
+                copy = board;
+                std::optional<Replay> replay;
+                if (!replays.empty()) {
+                    replay.emplace(copy);
+                }
+                GameResult result = play(copy, *players[i], Random::mix(gameSeed), statistics[i],
+                                         replay ? &*replay : nullptr);
+                statistics[i].add(result);
+
+                if (replay) {
+                    std::string name = "game-" + std::to_string(game) + "-" + strategies[i] + ".msrep";
+                    replay->save((std::filesystem::path(replays) / name).string());
+                }
+
+                if (!result.won && !archive.empty()) {
+                    std::string name = "game-" + std::to_string(game) + "-" + strategies[i] + ".msnap";
+                    Snapshot::save(copy, (std::filesystem::path(archive) / name).string());
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(totalsMutex);
+        for (std::size_t i = 0; i < totals.size(); i++) {
+            totals[i].merge(statistics[i]);
+        }
+    };
+
+    if (pool) {
+        pool->parallelFor(chunkCount, playChunk);
+    } else {
+        for (int chunk = 0; chunk < chunkCount; chunk++) {
+            playChunk(chunk);
+        }
+    }
+
+    return totals;
+}
+
+/**
+ * @function play
+ * @brief Lets a strategy play one game to the end.
+ *
+ * Each action the strategy returns is applied with Action::apply(), and the cells it changed are
+ * passed back to the strategy with the next request. The time each request takes is recorded.
+ *
+ * @param board The board to play, freshly generated.
+ * @param strategy The strategy that plays.
+ * @param seed The seed of the strategy's random choices.
+ * @param statistics The statistics the decision times are added to.
+ * @param replay Optional replay started on the board, which every action on the board is added to.
+ * @return Whether the game was won, and how many moves it took.
+ */
+GameSimulator::GameResult GameSimulator::play(Board &board, Strategy &strategy, std::uint64_t seed,
+                                              Statistics &statistics, Replay *replay) {
+    int maxMoves = MAX_ACTIONS_PER_CELL * board.getWidth() * board.getHeight();
+    GameResult result{false, 0};
+    std::vector<int> changedCells;
+
+    strategy.newGame(board, seed);
+
+    while (!board.isWon() && !board.isLost() && result.moves < maxMoves) {
+        auto start = std::chrono::steady_clock::now();
+        Action action = strategy.nextAction(changedCells);
+        auto end = std::chrono::steady_clock::now();
+        statistics.addLatency(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+        Action::apply(board, action, changedCells);
+        result.moves++;
+
+        if (replay && board.contains(action.x, action.y)) {
+            replay->record(board, {toMoveType(action.type), action.y * board.getWidth() + action.x, 0});
+        }
+    }
+
+    result.won = board.isWon();
+    return result;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file gamesimulator.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the GameSimulator class that plays large numbers of games without a user
+ *        interface, pitting one or more strategies against each other.
+ *
+ * Every game is numbered and derives its board from the seed and its number, so a run is
+ * reproducible and its result does not depend on the number of threads. When several strategies
+ * play, each game's board is generated once and every strategy plays its own copy of it right after
+ * the others, so they face identical boards under the same conditions. Games are handed out to the
+ * workers of a ThreadPool in chunks from a shared counter, so a worker that finishes its chunk
+ * early simply takes the next one. Each chunk has its own strategies, boards and Statistics, which
+ * are added to the totals when the chunk is done. The time every strategy takes to decide on each
+ * action is recorded in a log-scale histogram. The boards of lost games can be archived as
+ * snapshots, to be reloaded and looked at later, and every game can be saved as a Replay.
+ */
+
+#ifndef QT_MINESWEEPER_GAMESIMULATOR_H
+#define QT_MINESWEEPER_GAMESIMULATOR_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "board.h"
+#include "boardconfig.h"
+#include "replay.h"
+#include "strategy.h"
+#include "threadpool.h"
+
+class GameSimulator {
+public:
+
+    static constexpr int CHUNK_GAMES = 64;
+    static constexpr int MAX_ACTIONS_PER_CELL = 4; // A game that takes more actions is lost
+
+    struct GameResult {
+        bool won;
+        int moves; // Actions, including ignored ones
+    };
+
+    struct Statistics {
+        // Latency buckets: exact below 16 ns, then 16 buckets per power of two
+        static constexpr int LATENCY_SUB_BUCKETS = 16;
+
+        long long games = 0;
+        long long wins = 0;
+        long long moves = 0;
+        std::vector<long long> moveCounts; // moveCounts[n]: number of games that took n moves
+        std::vector<long long> latencyCounts; // Decisions per latency bucket
+
+        void add(const GameResult &result);
+
+        void addLatency(long long nanoseconds);
+
+        void merge(const Statistics &other);
+
+        int getMovePercentile(double percentile) const;
+
+        long long getLatencyPercentile(double percentile) const;
+    };
+
+    explicit GameSimulator(ThreadPool *pool = nullptr);
+
+    ~GameSimulator();
+
+    std::vector<Statistics> run(const BoardConfig &config, const std::vector<std::string> &strategies,
+                                long long games, std::uint64_t seed, bool noGuess = false,
+                                const std::string &archive = {}, const std::string &replays = {}) const;
+
+    static GameResult play(Board &board, Strategy &strategy, std::uint64_t seed, Statistics &statistics,
+                           Replay *replay = nullptr);
+
+private:
+
+    ThreadPool *pool;
+};
+
+#endif //QT_MINESWEEPER_GAMESIMULATOR_H
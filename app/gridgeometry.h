@@ -0,0 +1,86 @@
+/**
+ * @file gridgeometry.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the rectangle geometries that the neighbour loops of the board are compiled for.
+ *
+ * A geometry visits the neighbours of a cell given by its row-major index. For a cell off the
+ * border, the eight neighbours are at fixed offsets from it and are visited without any bounds
+ * check; only the cells on the border take the checked path. FixedGeometry knows the size of the
+ * board at compile time, so its offsets are constants, the loop over them is unrolled and turning
+ * an index into coordinates needs no division. RuntimeGeometry reads the size at runtime and runs
+ * the same code for any other board size.
+ */
+
+#ifndef QT_MINESWEEPER_GRIDGEOMETRY_H
+#define QT_MINESWEEPER_GRIDGEOMETRY_H
+
+#include <array>
+
+template<typename Size>
+class RectangleGeometry : private Size {
+public:
+
+    constexpr explicit RectangleGeometry(Size size = {}) : Size(size) {}
+
+    using Size::getWidth;
+    using Size::getHeight;
+
+    constexpr std::array<int, 8> getNeighbourOffsets() const {
+        int width = getWidth();
+        return {-width - 1, -width, -width + 1, -1, 1, width - 1, width, width + 1};
+    }
+
+    template<typename Visit>
+    void forEachNeighbour(int cell, Visit visit) const {
+        int width = getWidth();
+        int x = cell % width;
+        int y = cell / width;
+
+        if (x > 0 && x < width - 1 && y > 0 && y < getHeight() - 1) {
+            for (int offset: getNeighbourOffsets()) {
+                visit(cell + offset);
+            }
+            return;
+        }
+
+        for (int ny = y - 1; ny <= y + 1; ny++) {
+            for (int nx = x - 1; nx <= x + 1; nx++) {
+                if ((nx != x || ny != y) && nx >= 0 && nx < width && ny >= 0 && ny < getHeight()) {
+                    visit(ny * width + nx);
+                }
+            }
+        }
+    }
+};
+
+template<int Width, int Height>
+struct FixedSize {
+    static constexpr int getWidth() {
+        return Width;
+    }
+
+    static constexpr int getHeight() {
+        return Height;
+    }
+};
+
+struct RuntimeSize {
+    int width;
+    int height;
+
+    constexpr int getWidth() const {
+        return width;
+    }
+
+    constexpr int getHeight() const {
+        return height;
+    }
+};
+
+template<int Width, int Height>
+using FixedGeometry = RectangleGeometry<FixedSize<Width, Height>>;
+
+using RuntimeGeometry = RectangleGeometry<RuntimeSize>;
+
+#endif //QT_MINESWEEPER_GRIDGEOMETRY_H
@@ -0,0 +1,332 @@
+/**
+ * @file guibenchmark.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief GUI benchmarks of the MainWindow, run with Qt Test.
+ *
+ * Measures what players notice: how long the window takes to come up, to restart, to paint the
+ * cascade of a large opening after a click, to show the whole board after a mine is hit, and to
+ * paint one frame of the board, on several board sizes, and to pan across a million-cell board
+ * both at the usual zoom and zoomed all the way out. Clicks are sent to the tiles as synthetic
+ * mouse events and every measurement includes the repaints they cause, up to the last slice of
+ * the move reaching the view. The benchmarks use the
+ * offscreen platform unless QT_QPA_PLATFORM says otherwise, so they run on machines without a
+ * display. The click benchmarks report the median over a fixed set of games; run with -median N
+ * to take the median of N runs of the others.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QMessageBox>
+#include <QScrollBar>
+#include <QtTest>
+#include "constants.h"
+#include "mainwindow.h"
+
+namespace {
+
+constexpr int GAMES = 20; // Games measured by the click benchmarks
+
+// Scrolls a cell into view and clicks the middle of its tile
+void clickCell(BoardView *view, int cell, int width) {
+    view->ensureCellVisible(cell % width, cell / width);
+    QTest::mouseClick(view->viewport(), Qt::LeftButton, {}, view->cellRect(cell % width, cell / width).center());
+}
+
+// The hidden zero cell with the largest opening, or the first hidden safe cell if there is none
+int findLargestOpening(const Board &board) {
+    Board scratch = board;
+    scratch.setOpeningPending(false);
+    int best = -1;
+    int bestSize = 0;
+
+    for (int y = 0; y < board.getHeight(); y++) {
+        for (int x = 0; x < board.getWidth(); x++) {
+            if (board.isMine(x, y) || scratch.isRevealed(x, y)) {
+                continue;
+            }
+            if (best < 0) {
+                best = y * board.getWidth() + x;
+            }
+            if (board.getAdjacentMines(x, y) == 0) {
+                int before = scratch.getRevealedSafeCells();
+                scratch.reveal(x, y);
+                if (scratch.getRevealedSafeCells() - before > bestSize) {
+                    bestSize = scratch.getRevealedSafeCells() - before;
+                    best = y * board.getWidth() + x;
+                }
+            }
+        }
+    }
+    return best;
+}
+
+int findHiddenMine(const Board &board) {
+    for (int y = 0; y < board.getHeight(); y++) {
+        for (int x = 0; x < board.getWidth(); x++) {
+            if (board.isMine(x, y) && !board.isRevealed(x, y)) {
+                return y * board.getWidth() + x;
+            }
+        }
+    }
+    return -1;
+}
+
+// Handles every event that is pending, including the repaints they schedule
+void flushEvents() {
+    QCoreApplication::sendPostedEvents();
+    QCoreApplication::processEvents();
+}
+
+// Handles events until the last move has been handed to the view in full, slice by slice
+void settle(MainWindow &window) {
+    do {
+        flushEvents();
+    } while (!window.getGameLogicHandler()->isIdle());
+}
+
+// Adds the board sizes every benchmark runs on; the larger boards are sparse, so they have large
+// openings to cascade through
+void addSizes() {
+    QTest::addColumn<int>("width");
+    QTest::addColumn<int>("height");
+    QTest::addColumn<int>("mines");
+
+    QTest::newRow("expert") << GRID_WIDTH << GRID_HEIGHT << NUMBER_OF_MINES;
+    QTest::newRow("64x64") << 64 << 64 << 64 * 64 / 20;
+    QTest::newRow("128x128") << 128 << 128 << 128 * 128 / 20;
+}
+
+BoardConfig fetchConfig() {
+    QFETCH(int, width);
+    QFETCH(int, height);
+    QFETCH(int, mines);
+    return {width, height, mines};
+}
+
+// Reports the median time of the timed part over GAMES games as the benchmark result
+void reportMedian(const std::function<void(int)> &setup, const std::function<void(int)> &timed) {
+    std::vector<qint64> times;
+    for (int game = 0; game < GAMES; game++) {
+        setup(game);
+        QElapsedTimer timer;
+        timer.start();
+        timed(game);
+        times.push_back(timer.nsecsElapsed());
+    }
+
+    std::nth_element(times.begin(), times.begin() + GAMES / 2, times.end());
+    QTest::setBenchmarkResult(static_cast<qreal>(times[GAMES / 2]) / 1e6, QTest::WalltimeMilliseconds);
+}
+
+}
+
+class GuiBenchmark : public QObject {
+Q_OBJECT
+
+private slots:
+
+    void construction_data() { addSizes(); }
+
+    void construction();
+
+    void restart_data() { addSizes(); }
+
+    void restart();
+
+    void cascade_data() { addSizes(); }
+
+    void cascade();
+
+    void gameOver_data() { addSizes(); }
+
+    void gameOver();
+
+    void paint_data() { addSizes(); }
+
+    void paint();
+
+    void pan_data() {
+        QTest::addColumn<bool>("zoomedOut");
+        QTest::newRow("1024x1024/tiles") << false;
+        QTest::newRow("1024x1024/blended") << true;
+    }
+
+    void pan();
+};
+
+/**
+ * @function construction
+ * @brief Measures the time from creating the window to its first paint.
+ */
+void GuiBenchmark::construction() {
+    BoardConfig config = fetchConfig();
+
+    QBENCHMARK {
+        MainWindow window(config);
+        window.show();
+        flushEvents();
+    }
+}
+
+/**
+ * @function restart
+ * @brief Measures the time to start a new game and repaint the board.
+ */
+void GuiBenchmark::restart() {
+    BoardConfig config = fetchConfig();
+
+    MainWindow window(config);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    QBENCHMARK {
+        window.getGameLogicHandler()->restartGame();
+        flushEvents();
+    }
+}
+
+/**
+ * @function cascade
+ * @brief Measures the time from a click on the largest opening to the repaint of the revealed cells.
+ */
+void GuiBenchmark::cascade() {
+    BoardConfig config = fetchConfig();
+
+    MainWindow window(config);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    GameLogicHandler *handler = window.getGameLogicHandler();
+    int opening = -1;
+
+    reportMedian([&](int game) {
+        handler->startGame(game);
+        flushEvents();
+        opening = findLargestOpening(handler->getBoard());
+    }, [&](int) {
+        clickCell(window.getBoardView(), opening, config.width);
+        settle(window);
+    });
+
+    QVERIFY(handler->getBoard().getRevealedSafeCells() > 0);
+}
+
+/**
+ * @function gameOver
+ * @brief Measures the time from a click on a mine to the repaint of the whole revealed board.
+ *
+ * Each game is opened at its largest opening first. The game-over message box that the click
+ * shows is closed outside of the measurement.
+ */
+void GuiBenchmark::gameOver() {
+    BoardConfig config = fetchConfig();
+
+    MainWindow window(config);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    GameLogicHandler *handler = window.getGameLogicHandler();
+    int mine = -1;
+
+    reportMedian([&](int game) {
+        for (QMessageBox *box: window.findChildren<QMessageBox *>()) {
+            if (box->isVisible()) {
+                box->done(QMessageBox::Yes);
+            }
+        }
+        handler->startGame(game);
+        flushEvents();
+
+        int opening = findLargestOpening(handler->getBoard());
+        clickCell(window.getBoardView(), opening, config.width);
+        settle(window);
+        mine = findHiddenMine(handler->getBoard());
+    }, [&](int) {
+        clickCell(window.getBoardView(), mine, config.width);
+        settle(window);
+    });
+
+    QVERIFY(handler->getBoard().isLost());
+}
+
+/**
+ * @function paint
+ * @brief Measures the time to paint one frame of the viewport in the middle of a game.
+ */
+void GuiBenchmark::paint() {
+    BoardConfig config = fetchConfig();
+
+    MainWindow window(config);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    GameLogicHandler *handler = window.getGameLogicHandler();
+
+    handler->startGame(0);
+    int opening = findLargestOpening(handler->getBoard());
+    clickCell(window.getBoardView(), opening, config.width);
+    settle(window);
+
+    QBENCHMARK {
+        window.getBoardView()->viewport()->repaint();
+    }
+}
+
+/**
+ * @function pan
+ * @brief Measures the time to scroll a million-cell board by a quarter of the viewport and paint
+ *        the strip that scrolls into view, at the default zoom and zoomed all the way out.
+ */
+void GuiBenchmark::pan() {
+    QFETCH(bool, zoomedOut);
+    BoardConfig config{1024, 1024, 1024 * 1024 / 20};
+
+    MainWindow window(config);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    GameLogicHandler *handler = window.getGameLogicHandler();
+    BoardView *view = window.getBoardView();
+
+    handler->startGame(0);
+    clickCell(view, findLargestOpening(handler->getBoard()), config.width);
+    if (zoomedOut) {
+        view->setZoomLevel(0);
+    }
+    settle(window);
+
+    // Pans diagonally, back to the top left corner at the end of the board
+    QScrollBar *horizontal = view->horizontalScrollBar();
+    QScrollBar *vertical = view->verticalScrollBar();
+    auto step = [](QScrollBar *bar) {
+        bar->setValue(bar->value() < bar->maximum() ? bar->value() + bar->pageStep() / 4 : 0);
+    };
+    QBENCHMARK {
+        step(horizontal);
+        step(vertical);
+        flushEvents();
+    }
+}
+
+/**
+ * @function main
+ * @brief Entry point of the GUI benchmarks.
+ *
+ * Selects the offscreen platform unless another one is set, then runs the benchmarks with the
+ * usual Qt Test command line.
+ *
+ * @param argc The number of command-line arguments.
+ * @param argv The command-line arguments.
+ * @return The number of failed benchmarks.
+ */
+int main(int argc, char *argv[]) {
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication application(argc, argv);
+    GuiBenchmark benchmark;
+    return QTest::qExec(&benchmark, argc, argv);
+}
+
+#include "guibenchmark.moc"
@@ -0,0 +1,577 @@
+/**
+ * @file infiniteboard.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the InfiniteBoard class, which derives its mines from hashes and keeps
+ *        only the chunks in use in memory.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "adjacency.h"
+#include "infiniteboard.h"
+#include "random.h"
+#include "trace.h"
+
+namespace {
+
+// Hash of a chunk, from which the hashes of its cells are derived
+std::uint64_t hashChunk(std::uint64_t seed, std::int64_t chunkX, std::int64_t chunkY) {
+    return Random::mix(Random::mix(seed ^ static_cast<std::uint64_t>(chunkX)) + static_cast<std::uint64_t>(chunkY));
+}
+
+}
+
+/**
+ * @function InfiniteBoard
+ * @brief Constructs an endless board on which nothing has been revealed yet.
+ *
+ * @param seed The seed the mines are derived from.
+ * @param density The share of the cells that are mines, clamped to [MIN_DENSITY, MAX_DENSITY].
+ * @param maxChunks The number of chunks that are kept materialized, at least 16.
+ */
+InfiniteBoard::InfiniteBoard(std::uint64_t seed, double density, std::size_t maxChunks)
+        : seed(seed), density(std::clamp(density, MIN_DENSITY, MAX_DENSITY)),
+          threshold(static_cast<std::uint64_t>(std::ldexp(this->density, 64))),
+          maxChunks(std::max<std::size_t>(maxChunks, 16)), clock(0), revealedSafeCells(0), lost(false) {}
+
+/**
+ * @function ~InfiniteBoard
+ * @brief Destructor for InfiniteBoard.
+ */
+InfiniteBoard::~InfiniteBoard() = default;
+
+/**
+ * @function getSeed
+ * @brief Returns the seed the mines are derived from.
+ *
+ * @return The seed.
+ */
+std::uint64_t InfiniteBoard::getSeed() const {
+    return seed;
+}
+
+/**
+ * @function getDensity
+ * @brief Returns the share of the cells that are mines.
+ *
+ * @return The density, in [MIN_DENSITY, MAX_DENSITY].
+ */
+double InfiniteBoard::getDensity() const {
+    return density;
+}
+
+/**
+ * @function isMine
+ * @brief Returns true if the cell holds a mine.
+ *
+ * Computed from the hash of the cell, so it costs the same whether or not the chunk is
+ * materialized.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return True if the cell is a mine.
+ */
+bool InfiniteBoard::isMine(std::int64_t x, std::int64_t y) const {
+    ChunkKey key = getChunkKey(x, y);
+    return hasMine(hashChunk(seed, key.x, key.y), x, y);
+}
+
+/**
+ * @function getAdjacentMines
+ * @brief Returns the number of mines around a cell.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The adjacent mine count, in [0, 8]; 0 for mines.
+ */
+int InfiniteBoard::getAdjacentMines(std::int64_t x, std::int64_t y) const {
+    if (const Chunk *chunk = findChunk(getChunkKey(x, y))) {
+        return chunk->cells[getLocalIndex(x, y)] & ADJACENT_MASK;
+    }
+    if (isMine(x, y)) {
+        return 0;
+    }
+
+    int count = 0;
+    for (std::int64_t ny = y - 1; ny <= y + 1; ny++) {
+        for (std::int64_t nx = x - 1; nx <= x + 1; nx++) {
+            count += isMine(nx, ny);
+        }
+    }
+    return count;
+}
+
+/**
+ * @function isRevealed
+ * @brief Returns true if the cell has been revealed.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return True if the cell is revealed.
+ */
+bool InfiniteBoard::isRevealed(std::int64_t x, std::int64_t y) const {
+    ChunkKey key = getChunkKey(x, y);
+    int local = getLocalIndex(x, y);
+
+    if (const Chunk *chunk = findChunk(key)) {
+        return chunk->cells[local] & REVEALED_BIT;
+    }
+    auto stored = storedChunks.find(key);
+    return stored != storedChunks.end() &&
+           (stored->second.revealed[local >> CHUNK_SHIFT] >> (local & (CHUNK_SIZE - 1))) & 1;
+}
+
+/**
+ * @function getMark
+ * @brief Returns the mark the player has put on a hidden cell.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The mark of the cell.
+ */
+Board::Mark InfiniteBoard::getMark(std::int64_t x, std::int64_t y) const {
+    ChunkKey key = getChunkKey(x, y);
+    int local = getLocalIndex(x, y);
+
+    if (const Chunk *chunk = findChunk(key)) {
+        return static_cast<Board::Mark>(chunk->cells[local] >> MARK_SHIFT);
+    }
+    auto stored = storedChunks.find(key);
+    if (stored != storedChunks.end()) {
+        for (const auto &[index, mark]: stored->second.marks) {
+            if (index == local) {
+                return mark;
+            }
+        }
+    }
+    return Board::Mark::NONE;
+}
+
+/**
+ * @function reveal
+ * @brief Reveals a cell and, if it has no adjacent mines, the whole opening around it.
+ *
+ * The flood fill materializes every chunk it reaches. At the densities the board allows, an
+ * opening is finite, and the chunks beyond the limit are evicted once it is done.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @param revealedCells Optional list the coordinates of all newly revealed cells are appended to.
+ * @return Whether the cell was safe, a mine, or ignored because it was already revealed.
+ */
+Board::RevealResult InfiniteBoard::reveal(std::int64_t x, std::int64_t y, std::vector<Cell> *revealedCells) {
+    TRACE_SCOPE("InfiniteBoard::reveal");
+    if (lost) {
+        return Board::RevealResult::IGNORED;
+    }
+
+    // Reveals a hidden cell of a materialized chunk and returns its packed byte
+    auto revealCell = [&](Chunk &chunk, int local, std::int64_t cellX, std::int64_t cellY) {
+        std::uint8_t &cell = chunk.cells[local];
+        if (!(cell & MARK_MASK)) {
+            chunk.touchedCells++;
+        }
+        cell = (cell & ~MARK_MASK) | REVEALED_BIT;
+        if (revealedCells) {
+            revealedCells->push_back({cellX, cellY});
+        }
+        return cell;
+    };
+
+    Chunk &start = getChunk(getChunkKey(x, y));
+    int local = getLocalIndex(x, y);
+    if (start.cells[local] & REVEALED_BIT) {
+        trim();
+        return Board::RevealResult::IGNORED;
+    }
+
+    std::uint8_t cell = revealCell(start, local, x, y);
+    if (cell & MINE_BIT) {
+        lost = true;
+        trim();
+        return Board::RevealResult::MINE;
+    }
+    revealedSafeCells++;
+
+    if ((cell & ADJACENT_MASK) == 0) {
+        worklist.assign(1, {x, y});
+        ChunkKey currentKey = getChunkKey(x, y);
+        Chunk *current = &start;
+
+        while (!worklist.empty()) {
+            Cell zero = worklist.back();
+            worklist.pop_back();
+
+            for (std::int64_t ny = zero.y - 1; ny <= zero.y + 1; ny++) {
+                for (std::int64_t nx = zero.x - 1; nx <= zero.x + 1; nx++) {
+                    ChunkKey key = getChunkKey(nx, ny);
+                    if (key != currentKey) {
+                        currentKey = key;
+                        current = &getChunk(key);
+                    }
+
+                    int neighbour = getLocalIndex(nx, ny);
+                    if (current->cells[neighbour] & REVEALED_BIT) continue;
+
+                    // Neighbours of a zero cell are never mines
+                    revealedSafeCells++;
+                    if ((revealCell(*current, neighbour, nx, ny) & ADJACENT_MASK) == 0) {
+                        worklist.push_back({nx, ny});
+                    }
+                }
+            }
+        }
+    }
+
+    trim();
+    return Board::RevealResult::SAFE;
+}
+
+/**
+ * @function cycleMark
+ * @brief Cycles the mark of a hidden cell: none, flagged, questioned, none.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ */
+void InfiniteBoard::cycleMark(std::int64_t x, std::int64_t y) {
+    switch (getMark(x, y)) {
+        case Board::Mark::NONE:
+            setMark(x, y, Board::Mark::FLAGGED);
+            break;
+        case Board::Mark::FLAGGED:
+            setMark(x, y, Board::Mark::QUESTIONED);
+            break;
+        default:
+            setMark(x, y, Board::Mark::NONE);
+            break;
+    }
+}
+
+/**
+ * @function setMark
+ * @brief Puts a mark on a hidden cell.
+ *
+ * Revealed cells cannot be marked.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @param mark The new mark.
+ */
+void InfiniteBoard::setMark(std::int64_t x, std::int64_t y, Board::Mark mark) {
+    Chunk &chunk = getChunk(getChunkKey(x, y));
+    std::uint8_t &cell = chunk.cells[getLocalIndex(x, y)];
+    if (cell & REVEALED_BIT) {
+        trim();
+        return;
+    }
+
+    bool wasMarked = cell & MARK_MASK;
+    cell = (cell & ~MARK_MASK) | static_cast<std::uint8_t>(static_cast<int>(mark) << MARK_SHIFT);
+    chunk.touchedCells += (mark != Board::Mark::NONE) - wasMarked;
+    trim();
+}
+
+/**
+ * @function prefetch
+ * @brief Materializes every chunk that covers a rectangle of cells, such as the visible viewport.
+ *
+ * Reading materialized cells is a lookup, while the adjacent counts of the others are computed from
+ * the hashes of their neighbours on every read.
+ *
+ * @param minX The x-coordinate of the left column.
+ * @param minY The y-coordinate of the top row.
+ * @param maxX The x-coordinate of the right column.
+ * @param maxY The y-coordinate of the bottom row.
+ */
+void InfiniteBoard::prefetch(std::int64_t minX, std::int64_t minY, std::int64_t maxX, std::int64_t maxY) {
+    ChunkKey first = getChunkKey(minX, minY);
+    ChunkKey last = getChunkKey(maxX, maxY);
+
+    for (std::int64_t chunkY = first.y; chunkY <= last.y; chunkY++) {
+        for (std::int64_t chunkX = first.x; chunkX <= last.x; chunkX++) {
+            getChunk({chunkX, chunkY});
+        }
+    }
+    trim();
+}
+
+/**
+ * @function evict
+ * @brief Evicts the least recently used chunks until at most the given number are materialized.
+ *
+ * Chunks the player has not touched are dropped; the others are stored as their revealed plane and
+ * marks, and are rebuilt the next time they are used.
+ *
+ * @param maxChunks The number of chunks to keep.
+ */
+void InfiniteBoard::evict(std::size_t maxChunks) {
+    if (chunks.size() <= maxChunks) {
+        return;
+    }
+
+    std::vector<std::pair<std::uint64_t, ChunkKey>> byAge;
+    byAge.reserve(chunks.size());
+    for (const auto &[key, chunk]: chunks) {
+        byAge.emplace_back(chunk->lastUsed, key);
+    }
+    auto evictCount = static_cast<std::ptrdiff_t>(chunks.size() - maxChunks);
+    std::nth_element(byAge.begin(), byAge.begin() + evictCount, byAge.end(),
+                     [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    for (auto entry = byAge.begin(); entry != byAge.begin() + evictCount; ++entry) {
+        auto found = chunks.find(entry->second);
+        const Chunk &chunk = *found->second;
+
+        if (chunk.touchedCells > 0) {
+            StoredChunk &stored = storedChunks[entry->second];
+            stored.revealed.fill(0);
+            stored.marks.clear();
+            stored.touchedCells = chunk.touchedCells;
+
+            for (int local = 0; local < CHUNK_CELLS; local++) {
+                std::uint8_t cell = chunk.cells[local];
+                if (cell & REVEALED_BIT) {
+                    stored.revealed[local >> CHUNK_SHIFT] |= 1ULL << (local & (CHUNK_SIZE - 1));
+                } else if (cell & MARK_MASK) {
+                    stored.marks.emplace_back(static_cast<std::uint16_t>(local),
+                                              static_cast<Board::Mark>(cell >> MARK_SHIFT));
+                }
+            }
+        }
+        chunks.erase(found);
+    }
+}
+
+/**
+ * @function getRevealedSafeCells
+ * @brief Returns the number of safe cells the player has revealed.
+ *
+ * @return The number of revealed safe cells.
+ */
+long long InfiniteBoard::getRevealedSafeCells() const {
+    return revealedSafeCells;
+}
+
+/**
+ * @function isLost
+ * @brief Returns true if a mine has been revealed.
+ *
+ * @return True if the game is lost.
+ */
+bool InfiniteBoard::isLost() const {
+    return lost;
+}
+
+/**
+ * @function getMaterializedChunkCount
+ * @brief Returns the number of chunks that are currently materialized.
+ *
+ * @return The number of chunks, at most the chunk limit after every public call.
+ */
+std::size_t InfiniteBoard::getMaterializedChunkCount() const {
+    return chunks.size();
+}
+
+/**
+ * @function getStoredChunkCount
+ * @brief Returns the number of evicted chunks whose player state is kept.
+ *
+ * @return The number of stored chunks.
+ */
+std::size_t InfiniteBoard::getStoredChunkCount() const {
+    return storedChunks.size();
+}
+
+/**
+ * @function operator()
+ * @brief Hashes the coordinates of a chunk.
+ *
+ * @param key The coordinates.
+ * @return The hash.
+ */
+std::size_t InfiniteBoard::ChunkKeyHash::operator()(const ChunkKey &key) const {
+    return static_cast<std::size_t>(hashChunk(0, key.x, key.y));
+}
+
+/**
+ * @function getChunkKey
+ * @brief Returns the coordinates of the chunk a cell is in.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The chunk coordinates, rounded towards negative infinity.
+ */
+InfiniteBoard::ChunkKey InfiniteBoard::getChunkKey(std::int64_t x, std::int64_t y) {
+    return {x >> CHUNK_SHIFT, y >> CHUNK_SHIFT};
+}
+
+/**
+ * @function getLocalIndex
+ * @brief Returns the index of a cell within its chunk.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The row-major index in [0, CHUNK_CELLS).
+ */
+int InfiniteBoard::getLocalIndex(std::int64_t x, std::int64_t y) {
+    return static_cast<int>(((y & (CHUNK_SIZE - 1)) << CHUNK_SHIFT) | (x & (CHUNK_SIZE - 1)));
+}
+
+/**
+ * @function getChunk
+ * @brief Returns a chunk, materializing it if needed.
+ *
+ * A chunk that was evicted after the player touched it gets its revealed cells and marks back.
+ * Never evicts, so references stay valid until the next call to trim() or evict().
+ *
+ * @param key The coordinates of the chunk.
+ * @return The chunk.
+ */
+InfiniteBoard::Chunk &InfiniteBoard::getChunk(const ChunkKey &key) {
+    auto [entry, inserted] = chunks.try_emplace(key);
+    if (inserted) {
+        entry->second = std::make_unique<Chunk>();
+        Chunk &chunk = *entry->second;
+        buildChunk(key, chunk);
+
+        auto stored = storedChunks.find(key);
+        if (stored != storedChunks.end()) {
+            for (int local = 0; local < CHUNK_CELLS; local++) {
+                if ((stored->second.revealed[local >> CHUNK_SHIFT] >> (local & (CHUNK_SIZE - 1))) & 1) {
+                    chunk.cells[local] |= REVEALED_BIT;
+                }
+            }
+            for (const auto &[local, mark]: stored->second.marks) {
+                chunk.cells[local] |= static_cast<std::uint8_t>(static_cast<int>(mark) << MARK_SHIFT);
+            }
+            chunk.touchedCells = stored->second.touchedCells;
+            storedChunks.erase(stored);
+        }
+    }
+
+    entry->second->lastUsed = ++clock;
+    return *entry->second;
+}
+
+/**
+ * @function findChunk
+ * @brief Returns a chunk if it is materialized, without materializing it.
+ *
+ * @param key The coordinates of the chunk.
+ * @return The chunk, or nullptr.
+ */
+const InfiniteBoard::Chunk *InfiniteBoard::findChunk(const ChunkKey &key) const {
+    auto entry = chunks.find(key);
+    return entry != chunks.end() ? entry->second.get() : nullptr;
+}
+
+/**
+ * @function hasMine
+ * @brief Returns true if a cell holds a mine, given the hash of its chunk.
+ *
+ * The cells around the origin are never mines, so the first reveal of a game is safe.
+ *
+ * @param chunkHash The hash of the chunk the cell is in.
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return True if the cell is a mine.
+ */
+bool InfiniteBoard::hasMine(std::uint64_t chunkHash, std::int64_t x, std::int64_t y) const {
+    if (x >= -1 && x <= 1 && y >= -1 && y <= 1) {
+        return false;
+    }
+    return Random::mix(chunkHash + static_cast<std::uint64_t>(getLocalIndex(x, y))) < threshold;
+}
+
+/**
+ * @function buildChunk
+ * @brief Fills the mines and adjacent counts of a chunk, with nothing revealed or marked.
+ *
+ * The mines of the chunk and of the ring of cells around it are derived from their hashes into a
+ * small bit-plane, so the counts on the border see the mines of the neighbouring chunks without
+ * materializing them, and the counts are computed by the same Adjacency kernel as on a Board.
+ *
+ * @param key The coordinates of the chunk.
+ * @param chunk The chunk to fill.
+ */
+void InfiniteBoard::buildChunk(const ChunkKey &key, Chunk &chunk) const {
+    // The chunk plus a ring of one cell around it; the chunk's cell (x, y) is at (x + 1, y + 1)
+    constexpr int HALO_SIZE = CHUNK_SIZE + 2;
+    constexpr int HALO_WORDS = (HALO_SIZE + 63) / 64;
+    static_assert(CHUNK_SIZE == 64 && HALO_WORDS == 2, "a chunk row is expected to be one word");
+    std::array<std::uint64_t, HALO_WORDS * HALO_SIZE> plane{};
+    std::array<std::uint8_t, HALO_SIZE * HALO_SIZE> counts{};
+    std::int64_t originX = key.x << CHUNK_SHIFT;
+    std::int64_t originY = key.y << CHUNK_SHIFT;
+    auto setMine = [&](int haloX, int haloY) {
+        plane[haloY * HALO_WORDS + haloX / 64] |= 1ULL << (haloX % 64);
+    };
+
+    // The hashes of the chunk and of the eight around it, whose cells make up the ring
+    std::array<std::uint64_t, 9> ringHashes{};
+    for (int dy = 0; dy < 3; dy++) {
+        for (int dx = 0; dx < 3; dx++) {
+            ringHashes[dy * 3 + dx] = hashChunk(seed, key.x + dx - 1, key.y + dy - 1);
+        }
+    }
+    std::uint64_t chunkHash = ringHashes[4];
+
+    // Whole rows at a time and without branches, since whether a cell is a mine is a coin toss
+    for (int y = 0; y < CHUNK_SIZE; y++) {
+        std::uint64_t row = 0;
+        for (int x = 0; x < CHUNK_SIZE; x++) {
+            std::uint64_t hash = Random::mix(chunkHash + static_cast<std::uint64_t>(y << CHUNK_SHIFT | x));
+            row |= static_cast<std::uint64_t>(hash < threshold) << x;
+        }
+        plane[(y + 1) * HALO_WORDS] |= row << 1;
+        plane[(y + 1) * HALO_WORDS + 1] |= row >> 63;
+    }
+    for (std::int64_t y = -1; y <= 1; y++) {
+        for (std::int64_t x = -1; x <= 1; x++) {
+            if (getChunkKey(x, y) == key) {
+                int haloX = static_cast<int>(x - originX) + 1;
+                plane[(y - originY + 1) * HALO_WORDS + haloX / 64] &= ~(1ULL << (haloX % 64));
+            }
+        }
+    }
+
+    auto ringSide = [](int halo) { return halo == 0 ? 0 : halo == HALO_SIZE - 1 ? 2 : 1; };
+    auto setRingMine = [&](int haloX, int haloY) {
+        std::uint64_t hash = ringHashes[ringSide(haloY) * 3 + ringSide(haloX)];
+        if (hasMine(hash, originX + haloX - 1, originY + haloY - 1)) {
+            setMine(haloX, haloY);
+        }
+    };
+    for (int i = 0; i < HALO_SIZE; i++) {
+        setRingMine(i, 0);
+        setRingMine(i, HALO_SIZE - 1);
+    }
+    for (int i = 1; i < HALO_SIZE - 1; i++) {
+        setRingMine(0, i);
+        setRingMine(HALO_SIZE - 1, i);
+    }
+
+    Adjacency::computeRows(Adjacency::getBestKernel(), plane.data(), HALO_WORDS, HALO_SIZE, HALO_SIZE, 1,
+                           HALO_SIZE - 1, counts.data());
+
+    for (int y = 0; y < CHUNK_SIZE; y++) {
+        for (int x = 0; x < CHUNK_SIZE; x++) {
+            bool mine = (plane[(y + 1) * HALO_WORDS + (x + 1) / 64] >> ((x + 1) % 64)) & 1;
+            chunk.cells[y << CHUNK_SHIFT | x] = mine ? MINE_BIT : counts[(y + 1) * HALO_SIZE + x + 1];
+        }
+    }
+}
+
+/**
+ * @function trim
+ * @brief Evicts the least recently used quarter of the chunks once there are more than the limit.
+ *
+ * Evicting a batch at a time keeps the cost of finding the oldest chunks low.
+ */
+void InfiniteBoard::trim() {
+    if (chunks.size() > maxChunks) {
+        evict(maxChunks - maxChunks / 4);
+    }
+}
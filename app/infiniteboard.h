@@ -0,0 +1,139 @@
+/**
+ * @file infiniteboard.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the InfiniteBoard class, an endless board that is generated chunk by chunk as it
+ *        is played.
+ *
+ * The board has no edges: cell coordinates are 64-bit and may be negative. It is split into square
+ * chunks of CHUNK_SIZE cells. Whether a cell holds a mine is a pure function of the seed, the
+ * coordinates of its chunk and its position in the chunk, so any part of the board can be
+ * generated again at any time and adjacent counts across chunk borders need nothing but the mines
+ * of the border cells next door. A chunk is only materialized, with its packed cells and adjacent
+ * counts, when a reveal or a mark reaches it or prefetch() is asked to cover it; everything else
+ * costs no memory. Once more than the chunk limit are materialized, the least recently used ones
+ * are evicted: chunks the player never touched are dropped, and the others keep only their
+ * revealed bit-plane and their marks, from which the chunk is rebuilt when it is needed again. The
+ * cells around the origin never hold a mine, so a game starts by revealing (0, 0).
+ */
+
+#ifndef QT_MINESWEEPER_INFINITEBOARD_H
+#define QT_MINESWEEPER_INFINITEBOARD_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "board.h"
+
+class InfiniteBoard {
+public:
+
+    static constexpr int CHUNK_SHIFT = 6;
+    static constexpr int CHUNK_SIZE = 1 << CHUNK_SHIFT; // Cells per side of a chunk
+    static constexpr int CHUNK_CELLS = CHUNK_SIZE * CHUNK_SIZE;
+    static constexpr double MIN_DENSITY = 0.12; // Below about 0.1 a single opening can be infinite
+    static constexpr double MAX_DENSITY = 0.9;
+    static constexpr std::size_t DEFAULT_MAX_CHUNKS = 4096; // About 17 MB of materialized chunks
+
+    struct Cell {
+        std::int64_t x;
+        std::int64_t y;
+    };
+
+    explicit InfiniteBoard(std::uint64_t seed, double density = 0.16, std::size_t maxChunks = DEFAULT_MAX_CHUNKS);
+
+    ~InfiniteBoard();
+
+    std::uint64_t getSeed() const;
+
+    double getDensity() const;
+
+    bool isMine(std::int64_t x, std::int64_t y) const;
+
+    int getAdjacentMines(std::int64_t x, std::int64_t y) const;
+
+    bool isRevealed(std::int64_t x, std::int64_t y) const;
+
+    Board::Mark getMark(std::int64_t x, std::int64_t y) const;
+
+    Board::RevealResult reveal(std::int64_t x, std::int64_t y, std::vector<Cell> *revealedCells = nullptr);
+
+    void cycleMark(std::int64_t x, std::int64_t y);
+
+    void setMark(std::int64_t x, std::int64_t y, Board::Mark mark);
+
+    void prefetch(std::int64_t minX, std::int64_t minY, std::int64_t maxX, std::int64_t maxY);
+
+    void evict(std::size_t maxChunks);
+
+    long long getRevealedSafeCells() const;
+
+    bool isLost() const;
+
+    std::size_t getMaterializedChunkCount() const;
+
+    std::size_t getStoredChunkCount() const;
+
+private:
+
+    // Layout of a packed cell byte, the same as in Board
+    static constexpr std::uint8_t ADJACENT_MASK = 0x0F;
+    static constexpr std::uint8_t MINE_BIT = 0x10;
+    static constexpr std::uint8_t REVEALED_BIT = 0x20;
+    static constexpr int MARK_SHIFT = 6;
+    static constexpr std::uint8_t MARK_MASK = 0xC0;
+
+    struct ChunkKey {
+        std::int64_t x;
+        std::int64_t y;
+
+        bool operator==(const ChunkKey &other) const = default;
+    };
+
+    struct ChunkKeyHash {
+        std::size_t operator()(const ChunkKey &key) const;
+    };
+
+    struct Chunk {
+        std::array<std::uint8_t, CHUNK_CELLS> cells; // row-major, index = localY * CHUNK_SIZE + localX
+        int touchedCells = 0; // Cells that are revealed or marked; a chunk without any is simply dropped
+        std::uint64_t lastUsed = 0;
+    };
+
+    // What is left of an evicted chunk the player touched
+    struct StoredChunk {
+        std::array<std::uint64_t, CHUNK_SIZE> revealed; // Bit localX of word localY
+        std::vector<std::pair<std::uint16_t, Board::Mark>> marks; // Cell index and mark of every marked cell
+        int touchedCells;
+    };
+
+    static ChunkKey getChunkKey(std::int64_t x, std::int64_t y);
+
+    static int getLocalIndex(std::int64_t x, std::int64_t y);
+
+    Chunk &getChunk(const ChunkKey &key);
+
+    const Chunk *findChunk(const ChunkKey &key) const;
+
+    bool hasMine(std::uint64_t chunkHash, std::int64_t x, std::int64_t y) const;
+
+    void buildChunk(const ChunkKey &key, Chunk &chunk) const;
+
+    void trim();
+
+    std::uint64_t seed;
+    double density;
+    std::uint64_t threshold; // A cell is a mine if its hash is below this
+    std::size_t maxChunks;
+    std::uint64_t clock; // Counts chunk uses, for least-recently-used eviction
+    long long revealedSafeCells;
+    bool lost;
+    std::unordered_map<ChunkKey, std::unique_ptr<Chunk>, ChunkKeyHash> chunks;
+    std::unordered_map<ChunkKey, StoredChunk, ChunkKeyHash> storedChunks;
+    std::vector<Cell> worklist; // Zero cells whose neighbours still have to be opened, reused across reveals
+};
+
+#endif //QT_MINESWEEPER_INFINITEBOARD_H
@@ -6,12 +6,19 @@
  */
 
 #include <QApplication>
+#include <QCommandLineParser>
 #include "mainwindow.h"
+#include "trace.h"
 
 /**
  * @function main
  * @brief Entry point of the Minesweeper game.
  *
+ * The board size and mine count default to the expert board and can be changed with the --width,
+ * --height and --mines options. With --load, the game starts from a saved snapshot instead. With
+ * --trace, the timings recorded by a tracing build are written as a Chrome trace when the game
+ * exits.
+ *
  * @param argc The number of command-line arguments.
  * @param argv The command-line arguments.
  * @return The exit code of the application.
@@ -21,7 +28,47 @@ int main(int argc, char *argv[]) {
     QCoreApplication::setApplicationName("Minesweeper");
     QCoreApplication::setApplicationVersion("1.0.0");
 
-    MainWindow mainWindow;
+    BoardConfig config = BoardConfig::expert();
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addVersionOption();
+    QCommandLineOption widthOption("width", "Number of tiles in a row.", "tiles", QString::number(config.width));
+    QCommandLineOption heightOption("height", "Number of tiles in a column.", "tiles", QString::number(config.height));
+    QCommandLineOption minesOption("mines", "Number of mines.", "count", QString::number(config.mineCount));
+    QCommandLineOption loadOption("load", "Start from a game saved as a snapshot.", "file");
+    QCommandLineOption traceOption("trace", "Write a Chrome trace of the session to the file on exit (needs a build "
+                                            "with MINESWEEPER_TRACING).", "file");
+    parser.addOptions({widthOption, heightOption, minesOption, loadOption, traceOption});
+    parser.process(application);
+
+    if (parser.isSet(traceOption)) {
+        Trace::writeAtExit(parser.value(traceOption).toStdString());
+    }
+
+    config.width = parser.value(widthOption).toInt();
+    config.height = parser.value(heightOption).toInt();
+    config.mineCount = parser.value(minesOption).toInt();
+
+    if (!config.isValid()) {
+        qCritical() << "Invalid board configuration: " << config.width << "x" << config.height << ", "
+                    << config.mineCount << " mines";
+        return 1;
+    }
+
+    MainWindow mainWindow(config);
+    if (parser.isSet(loadOption)) {
+        switch (mainWindow.getGameLogicHandler()->loadGame(parser.value(loadOption).toStdString())) {
+            case GameLogicHandler::LoadResult::LOADED:
+                break;
+            case GameLogicHandler::LoadResult::INVALID:
+                qCritical() << "Invalid snapshot: " << parser.value(loadOption);
+                return 1;
+            case GameLogicHandler::LoadResult::UNSUPPORTED:
+                qCritical() << "Only rectangular boards can be shown: " << parser.value(loadOption);
+                return 1;
+        }
+    }
     mainWindow.showNormal();
 
     return QApplication::exec();
@@ -9,77 +9,201 @@
 #include <iostream>
 #include <QMessageBox>
 #include <QApplication>
+#include <QFileDialog>
+#include <QMenuBar>
+#include <QStatusBar>
+#include <QVBoxLayout>
+#include "endlesswindow.h"
 #include "mainwindow.h"
-#include "constants.h"
-#include "gamelogichandler.h"
+#include "trace.h"
 
 /**
  * @function MainWindow
  * @brief Constructor for MainWindow.
  *
- * This constructor sets up the main window of the Minesweeper game, including the grid of tiles
- * and connections to handle game-over events.
+ * This constructor sets up the main window of the Minesweeper game, including the board view, the
+ * Game menu with the save, open, hint, auto-solve, probability overlay and no-guess actions and the
+ * action that opens an endless game in its own window, the View menu with the zoom and animation
+ * actions, and the connections between the view, the game logic and the game-over handling.
+ * Tracing builds also get an action to save the recorded timings.
  *
+ * @param config The size and mine count of the board. Must be valid.
  * @param parent The parent widget of the MainWindow, typically the desktop.
  */
-MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), gridLayout(new QGridLayout) {
+MainWindow::MainWindow(const BoardConfig &config, QWidget *parent)
+        : QMainWindow(parent), gameLogicHandler(new GameLogicHandler(config)) {
     auto *centralWidget = new QWidget(this);
     setCentralWidget(centralWidget);
-    centralWidget->setLayout(gridLayout);
-    gridLayout->setSpacing(1);
+    auto *layout = new QVBoxLayout(centralWidget);
 
-    gameLogicHandler = new GameLogicHandler(centralWidget);
+    boardView = new BoardView(gameLogicHandler->getBoard(), centralWidget);
+    layout->addWidget(boardView);
+
+    connect(boardView, &BoardView::revealRequested, gameLogicHandler, &GameLogicHandler::revealCell);
+    connect(boardView, &BoardView::markRequested, gameLogicHandler, &GameLogicHandler::markCell);
+    connect(boardView, &BoardView::chordRequested, gameLogicHandler, &GameLogicHandler::chordCell);
+    connect(gameLogicHandler, &GameLogicHandler::cellsChanged, boardView, &BoardView::updateCells);
+    connect(gameLogicHandler, &GameLogicHandler::cellsPending, boardView, &BoardView::deferCells);
+    connect(gameLogicHandler, &GameLogicHandler::boardReset, boardView, &BoardView::updateAll);
     connect(gameLogicHandler, &GameLogicHandler::gameOver, this, &MainWindow::onGameOver);
     connect(this, &MainWindow::restartGame, gameLogicHandler, &GameLogicHandler::restartGame);
 
-    for (int i = 0; i < GRID_WIDTH; ++i) {
-        for (int j = 0; j < GRID_HEIGHT; ++j) {
-            Tile *tile = gameLogicHandler->getTile(i, j);
-            gridLayout->addWidget(tile, j, i);
+    QMenu *gameMenu = menuBar()->addMenu("&Game");
+    QAction *saveAction = gameMenu->addAction("&Save game...");
+    saveAction->setShortcut(QKeySequence::Save);
+    QAction *openAction = gameMenu->addAction("&Open game...");
+    openAction->setShortcut(QKeySequence::Open);
+    QAction *saveReplayAction = gameMenu->addAction("Save &replay...");
+
+    gameMenu->addSeparator();
+    QAction *hintAction = gameMenu->addAction("&Hint");
+    hintAction->setShortcut(Qt::Key_H);
+    QAction *autoSolveAction = gameMenu->addAction("&Auto-solve");
+    autoSolveAction->setShortcut(Qt::Key_A);
+
+    QAction *probabilityAction = gameMenu->addAction("Show &probabilities");
+    probabilityAction->setShortcut(Qt::Key_P);
+    probabilityAction->setCheckable(true);
+
+    gameMenu->addSeparator();
+    QAction *noGuessAction = gameMenu->addAction("&No-guess boards");
+    noGuessAction->setCheckable(true);
+    QAction *endlessAction = gameMenu->addAction("&Endless game...");
+
+    QMenu *viewMenu = menuBar()->addMenu("&View");
+    QAction *zoomInAction = viewMenu->addAction("Zoom &in");
+    zoomInAction->setShortcut(QKeySequence::ZoomIn);
+    QAction *zoomOutAction = viewMenu->addAction("Zoom &out");
+    zoomOutAction->setShortcut(QKeySequence::ZoomOut);
+    QAction *resetZoomAction = viewMenu->addAction("&Actual size");
+    resetZoomAction->setShortcut(Qt::CTRL | Qt::Key_0);
+    viewMenu->addSeparator();
+    QAction *animateAction = viewMenu->addAction("A&nimate reveals");
+    animateAction->setCheckable(true);
+
+    connect(zoomInAction, &QAction::triggered, boardView, &BoardView::zoomIn);
+    connect(zoomOutAction, &QAction::triggered, boardView, &BoardView::zoomOut);
+    connect(resetZoomAction, &QAction::triggered, boardView, &BoardView::resetZoom);
+    connect(animateAction, &QAction::toggled, gameLogicHandler, &GameLogicHandler::setAnimated);
+    connect(saveAction, &QAction::triggered, this, [this]() {
+        QString path = QFileDialog::getSaveFileName(this, "Save game", "minesweeper.msnap", "Snapshots (*.msnap)");
+        if (!path.isEmpty() && !gameLogicHandler->saveGame(path.toStdString())) {
+            statusBar()->showMessage("Could not write " + path, 3000);
         }
-    }
+    });
+    connect(openAction, &QAction::triggered, this, [this]() {
+        QString path = QFileDialog::getOpenFileName(this, "Open game", {}, "Snapshots (*.msnap)");
+        if (path.isEmpty()) {
+            return;
+        }
+        switch (gameLogicHandler->loadGame(path.toStdString())) {
+            case GameLogicHandler::LoadResult::LOADED:
+                break;
+            case GameLogicHandler::LoadResult::INVALID:
+                statusBar()->showMessage(path + " is not a valid snapshot", 3000);
+                break;
+            case GameLogicHandler::LoadResult::UNSUPPORTED:
+                statusBar()->showMessage(path + " is a torus or hexagonal board, which cannot be shown", 3000);
+                break;
+        }
+    });
+    connect(saveReplayAction, &QAction::triggered, this, [this]() {
+        QString path = QFileDialog::getSaveFileName(this, "Save replay", "minesweeper.msrep", "Replays (*.msrep)");
+        if (!path.isEmpty() && !gameLogicHandler->saveReplay(path.toStdString())) {
+            statusBar()->showMessage("Could not write a replay to " + path, 3000);
+        }
+    });
+    connect(hintAction, &QAction::triggered, gameLogicHandler, &GameLogicHandler::showHint);
+    connect(autoSolveAction, &QAction::triggered, gameLogicHandler, &GameLogicHandler::autoSolve);
+    connect(probabilityAction, &QAction::toggled, gameLogicHandler, &GameLogicHandler::setProbabilityOverlay);
+    connect(noGuessAction, &QAction::toggled, gameLogicHandler, &GameLogicHandler::setNoGuess);
+    connect(endlessAction, &QAction::triggered, this, [this]() {
+        auto *endlessWindow = new EndlessWindow(this);
+        endlessWindow->setAttribute(Qt::WA_DeleteOnClose);
+        endlessWindow->show();
+    });
+    connect(gameLogicHandler, &GameLogicHandler::hintFound, boardView, &BoardView::showHint);
+    connect(gameLogicHandler, &GameLogicHandler::probabilitiesChanged, boardView, &BoardView::setProbabilities);
+    connect(gameLogicHandler, &GameLogicHandler::noHintFound, this, [this]() {
+        statusBar()->showMessage("No cell can be proven safe, you have to guess.", 3000);
+    });
+
+#ifdef MINESWEEPER_TRACING
+    gameMenu->addSeparator();
+    QAction *traceAction = gameMenu->addAction("Save &trace...");
+    connect(traceAction, &QAction::triggered, this, [this]() {
+        QString path = QFileDialog::getSaveFileName(this, "Save trace", "minesweeper-trace.json", "JSON (*.json)");
+        if (!path.isEmpty() && !Trace::write(path.toStdString())) {
+            statusBar()->showMessage("Could not write " + path, 3000);
+        }
+    });
+#endif
 }
 
 /**
  * @function ~MainWindow
  * @brief Destructor for MainWindow.
  *
- * Cleans up dynamically allocated resources owned by the MainWindow instance.
+ * Cleans up dynamically allocated resources owned by the MainWindow instance. The board view is a
+ * child widget and is deleted by Qt.
  */
 MainWindow::~MainWindow() {
-    delete gridLayout;
     delete gameLogicHandler;
 }
 
+/**
+ * @function getGameLogicHandler
+ * @brief Gets the game logic behind the window.
+ *
+ * @return The GameLogicHandler, owned by the window.
+ */
+GameLogicHandler *MainWindow::getGameLogicHandler() const {
+    return gameLogicHandler;
+}
+
+/**
+ * @function getBoardView
+ * @brief Gets the view that draws the board.
+ *
+ * @return The BoardView, a child widget of the window.
+ */
+BoardView *MainWindow::getBoardView() const {
+    return boardView;
+}
+
 /**
  * @function onGameOver
  * @brief Handles the game-over event.
  *
  * Invoked when the GameLogicHandler emits the gameOver signal. This slot displays a message box
- * prompting the user to play again or quit the game.
+ * prompting the user to play again or quit the game. The box is window-modal and opened without a
+ * nested event loop, so the revealed board is painted behind it and the slot returns right away;
+ * the answer is handled when the box is closed.
  *
  * @param won Boolean flag indicating if the game was won (true) or lost (false).
  */
 void MainWindow::onGameOver(bool won) {
-    QMessageBox msgBox;
-    msgBox.setWindowTitle("Game Over");
-    msgBox.setText(won ? "Congratulations! You won!" : "Boom! Game over.");
-    msgBox.setInformativeText("Do you want to play again?");
-    msgBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
-    msgBox.setDefaultButton(QMessageBox::Yes);
-
-    int ret = msgBox.exec();
-
-    switch (ret) {
-        case QMessageBox::Yes:
-            emit restartGame();
-            break;
-        case QMessageBox::No:
-            QApplication::quit();
-            break;
-        default:
-            // should never be reached
-            qDebug() << "Invalid return value from QMessageBox::exec()";
-            break;
-    }
+    auto *msgBox = new QMessageBox(this);
+    msgBox->setAttribute(Qt::WA_DeleteOnClose);
+    msgBox->setWindowTitle("Game Over");
+    msgBox->setText(won ? "Congratulations! You won!" : "Boom! Game over.");
+    msgBox->setInformativeText("Do you want to play again?");
+    msgBox->setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+    msgBox->setDefaultButton(QMessageBox::Yes);
+
+    connect(msgBox, &QMessageBox::finished, this, [this](int ret) {
+        switch (ret) {
+            case QMessageBox::Yes:
+                emit restartGame();
+                break;
+            case QMessageBox::No:
+                QApplication::quit();
+                break;
+            default:
+                // should never be reached
+                qDebug() << "Invalid result of the game-over message box";
+                break;
+        }
+    });
+    msgBox->open();
 }
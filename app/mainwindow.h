@@ -9,9 +9,8 @@
 #define QT_MINESWEEPER_MAINWINDOW_H
 
 #include <QMainWindow>
-#include <QPushButton>
-#include <QGridLayout>
-#include "tile.h"
+#include "boardconfig.h"
+#include "boardview.h"
 #include "gamelogichandler.h"
 
 class MainWindow : public QMainWindow {
@@ -19,7 +18,7 @@ Q_OBJECT
 
 public:
 
-    explicit MainWindow(QWidget *parent = nullptr);
+    explicit MainWindow(const BoardConfig &config = BoardConfig::expert(), QWidget *parent = nullptr);
 
     ~MainWindow() override;
 
@@ -31,6 +30,10 @@ public:
 
     MainWindow &operator=(MainWindow &&) = delete;
 
+    GameLogicHandler *getGameLogicHandler() const;
+
+    BoardView *getBoardView() const;
+
 
 signals:
 
@@ -41,8 +44,8 @@ private slots:
     void onGameOver(bool won);
 
 private:
-    QGridLayout *gridLayout;
     GameLogicHandler *gameLogicHandler;
+    BoardView *boardView;
 };
 
 #endif //QT_MINESWEEPER_MAINWINDOW_H
@@ -0,0 +1,122 @@
+/**
+ * @file noguessgenerator.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the NoGuessGenerator class, which searches candidate boards in parallel
+ *        for one the Solver can finish from the start cell.
+ */
+
+#include <atomic>
+#include <vector>
+#include "boardgenerator.h"
+#include "noguessgenerator.h"
+#include "random.h"
+#include "solver.h"
+#include "trace.h"
+
+/**
+ * @function NoGuessGenerator
+ * @brief Constructs a NoGuessGenerator.
+ *
+ * @param pool The pool the candidates are checked on, or nullptr to check them on the calling
+ *             thread. The result does not depend on it.
+ */
+NoGuessGenerator::NoGuessGenerator(ThreadPool *pool) : pool(pool) {}
+
+/**
+ * @function ~NoGuessGenerator
+ * @brief Destructor for NoGuessGenerator.
+ *
+ * The pool is not owned by the generator.
+ */
+NoGuessGenerator::~NoGuessGenerator() = default;
+
+/**
+ * @function generate
+ * @brief Lays out the mines of a board that can be solved from the start cell without guessing.
+ *
+ * On success the board holds the mines of the accepted candidate, none of them in the 3x3
+ * neighbourhood of the start cell, and its seed is the candidate seed. Nothing is revealed: the
+ * caller reveals the start cell to begin the game. Clearing the opening on the first reveal is
+ * turned off, since the layout must stay exactly as it was checked.
+ *
+ * @param board The board to fill, of the size and mine count to generate. It is reset first.
+ * @param seed The seed the candidates are derived from.
+ * @param startX The x-coordinate of the start cell.
+ * @param startY The y-coordinate of the start cell.
+ * @param stop Stops the search when a stop is requested.
+ * @return True if a board was found, false if the search was stopped or no candidate out of
+ *         MAX_CANDIDATES could be solved. The board is left reset in that case.
+ */
+bool NoGuessGenerator::generate(Board &board, std::uint64_t seed, int startX, int startY,
+                                std::stop_token stop) const {
+    TRACE_SCOPE("NoGuessGenerator::generate");
+    int width = board.getWidth();
+    int height = board.getHeight();
+    int mineCount = board.getMineCount();
+
+    std::atomic<int> nextCandidate(0);
+    std::atomic<int> accepted(MAX_CANDIDATES);
+
+    // Every worker checks candidates in increasing order until a lower one has been accepted, so
+    // all candidates below the accepted one are known to be invalid
+    auto worker = [&](int) {
+        BoardGenerator generator;
+        Board candidate(width, height, mineCount, board.getTopology());
+        Solver solver(candidate);
+        std::vector<int> revealedCells;
+
+        while (!stop.stop_requested()) {
+            int number = nextCandidate.fetch_add(1, std::memory_order_relaxed);
+            if (number >= accepted.load(std::memory_order_relaxed)) {
+                break;
+            }
+
+            candidate.reset();
+            generator.generate(candidate, getCandidateSeed(seed, number));
+            revealedCells.clear();
+            candidate.reveal(startX, startY, &revealedCells);
+            solver.reset();
+
+            for (int cell = solver.findSafeCell(); cell >= 0 && !candidate.isWon(); cell = solver.findSafeCell()) {
+                revealedCells.clear();
+                candidate.reveal(cell % width, cell / width, &revealedCells);
+                solver.update(revealedCells);
+            }
+
+            if (candidate.isWon()) {
+                int current = accepted.load(std::memory_order_relaxed);
+                while (number < current && !accepted.compare_exchange_weak(current, number)) {}
+            }
+        }
+    };
+
+    if (pool) {
+        pool->parallelFor(pool->getThreadCount(), worker);
+    } else {
+        worker(0);
+    }
+
+    board.reset();
+    if (stop.stop_requested() || accepted.load() == MAX_CANDIDATES) {
+        return false;
+    }
+
+    // Rebuild the accepted candidate; the first reveal moves the same mines as during the check
+    BoardGenerator(pool).generate(board, getCandidateSeed(seed, accepted.load()));
+    board.clearOpening(startX, startY);
+    board.setOpeningPending(false);
+    return true;
+}
+
+/**
+ * @function getCandidateSeed
+ * @brief Returns the seed of a numbered candidate board.
+ *
+ * @param seed The seed the candidates are derived from.
+ * @param candidate The number of the candidate.
+ * @return The seed the candidate is generated from.
+ */
+std::uint64_t NoGuessGenerator::getCandidateSeed(std::uint64_t seed, int candidate) {
+    return Random::mix(seed) + static_cast<std::uint64_t>(candidate);
+}
@@ -0,0 +1,43 @@
+/**
+ * @file noguessgenerator.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the NoGuessGenerator class that lays out boards which can be solved without
+ *        guessing.
+ *
+ * Candidate boards are derived from the seed and numbered. Each one is generated, opened at the
+ * start cell and played by the Solver until it is stuck or won; a candidate is accepted if the
+ * solver wins. The workers of a ThreadPool take candidate numbers from a shared counter and stop as
+ * soon as a candidate with a lower number has been accepted, so the accepted board is always the
+ * lowest-numbered valid one and the same seed gives the same board whatever the number of threads.
+ * A std::stop_token cancels the search early, for example when the settings change while a board
+ * is generated in the background.
+ */
+
+#ifndef QT_MINESWEEPER_NOGUESSGENERATOR_H
+#define QT_MINESWEEPER_NOGUESSGENERATOR_H
+
+#include <cstdint>
+#include <stop_token>
+#include "board.h"
+#include "threadpool.h"
+
+class NoGuessGenerator {
+public:
+
+    static constexpr int MAX_CANDIDATES = 1 << 16;
+
+    explicit NoGuessGenerator(ThreadPool *pool = nullptr);
+
+    ~NoGuessGenerator();
+
+    bool generate(Board &board, std::uint64_t seed, int startX, int startY, std::stop_token stop = {}) const;
+
+    static std::uint64_t getCandidateSeed(std::uint64_t seed, int candidate);
+
+private:
+
+    ThreadPool *pool;
+};
+
+#endif //QT_MINESWEEPER_NOGUESSGENERATOR_H
@@ -0,0 +1,130 @@
+/**
+ * @file pixmapcache.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the PixmapCache class, which decodes each image asset once and shares
+ *        scaled copies of it across the whole application.
+ */
+
+#include <QDebug>
+#include <QDir>
+#include "pixmapcache.h"
+
+/**
+ * @function instance
+ * @brief Returns the process-wide cache.
+ *
+ * Pixmaps may only be used on the GUI thread, so the cache is not synchronised.
+ *
+ * @return The shared PixmapCache.
+ */
+PixmapCache &PixmapCache::instance() {
+    static PixmapCache cache;
+    return cache;
+}
+
+/**
+ * @function PixmapCache
+ * @brief Constructs an empty cache.
+ */
+PixmapCache::PixmapCache() : hits(0), misses(0) {}
+
+/**
+ * @function ~PixmapCache
+ * @brief Destructor for PixmapCache.
+ *
+ * The pixmaps are value members, so there is nothing to clean up explicitly.
+ */
+PixmapCache::~PixmapCache() = default;
+
+/**
+ * @function pixmap
+ * @brief Returns an image asset scaled to fit a square of the given size.
+ *
+ * The asset keeps its aspect ratio. The returned pixmap has the device pixel ratio set, so its
+ * pixel size is the logical size multiplied by the ratio. A hit only costs a hash lookup; a miss
+ * scales the decoded asset, decoding it first if this is the first time it is used.
+ *
+ * @param path The resource path of the asset.
+ * @param size The logical width and height of the square the asset has to fit in.
+ * @param devicePixelRatio The device pixel ratio of the screen the pixmap is drawn on.
+ * @return The scaled pixmap, or a null pixmap if the asset could not be loaded.
+ */
+QPixmap PixmapCache::pixmap(const QString &path, int size, qreal devicePixelRatio) {
+    QString key = QStringLiteral("%1@%2x%3").arg(path).arg(size).arg(devicePixelRatio);
+
+    auto it = scaledPixmaps.constFind(key);
+    if (it != scaledPixmaps.constEnd()) {
+        hits++;
+        return it.value();
+    }
+
+    misses++;
+
+    const QPixmap &source = decoded(path);
+    if (source.isNull()) {
+        return source;
+    }
+
+    int pixels = qRound(size * devicePixelRatio);
+    QPixmap scaled = source.scaled(pixels, pixels, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    scaled.setDevicePixelRatio(devicePixelRatio);
+
+    scaledPixmaps.insert(key, scaled);
+    return scaled;
+}
+
+/**
+ * @function clear
+ * @brief Drops every cached pixmap and resets the counters.
+ */
+void PixmapCache::clear() {
+    decodedPixmaps.clear();
+    scaledPixmaps.clear();
+    hits = 0;
+    misses = 0;
+}
+
+/**
+ * @function getHits
+ * @brief Returns the number of lookups served from the cache.
+ *
+ * @return The number of cache hits.
+ */
+int PixmapCache::getHits() const {
+    return hits;
+}
+
+/**
+ * @function getMisses
+ * @brief Returns the number of lookups that had to scale (and possibly decode) an asset.
+ *
+ * @return The number of cache misses.
+ */
+int PixmapCache::getMisses() const {
+    return misses;
+}
+
+/**
+ * @function decoded
+ * @brief Returns the full-size decoded asset, decoding it on first use.
+ *
+ * Failed loads are cached as null pixmaps too, so a missing asset is only reported once.
+ *
+ * @param path The resource path of the asset.
+ * @return The decoded asset, or a null pixmap if it could not be loaded.
+ */
+const QPixmap &PixmapCache::decoded(const QString &path) {
+    auto it = decodedPixmaps.find(path);
+    if (it != decodedPixmaps.end()) {
+        return it.value();
+    }
+
+    QPixmap pixmap(path);
+    if (pixmap.isNull()) {
+        qDebug() << "Failed to load image: " << path;
+        qDebug() << "Current directory: " << QDir::currentPath();
+    }
+
+    return decodedPixmaps.insert(path, pixmap).value();
+}
@@ -0,0 +1,55 @@
+/**
+ * @file pixmapcache.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the PixmapCache class, a process-wide cache of decoded and pre-scaled images.
+ *
+ * Decoding a PNG from the resource file is by far the most expensive part of drawing a tile, so
+ * every asset is decoded at most once per process. Scaled copies are cached per target size and
+ * device pixel ratio, so redrawing the board after a restart, a game over or a screen change only
+ * costs hash lookups. Hit and miss counters make the effect measurable.
+ */
+
+#ifndef QT_MINESWEEPER_PIXMAPCACHE_H
+#define QT_MINESWEEPER_PIXMAPCACHE_H
+
+#include <QHash>
+#include <QPixmap>
+#include <QString>
+
+class PixmapCache {
+public:
+
+    static PixmapCache &instance();
+
+    PixmapCache(const PixmapCache &) = delete;
+
+    PixmapCache &operator=(const PixmapCache &) = delete;
+
+    PixmapCache(PixmapCache &&) = delete;
+
+    PixmapCache &operator=(PixmapCache &&) = delete;
+
+    QPixmap pixmap(const QString &path, int size, qreal devicePixelRatio);
+
+    void clear();
+
+    int getHits() const;
+
+    int getMisses() const;
+
+private:
+
+    PixmapCache();
+
+    ~PixmapCache();
+
+    const QPixmap &decoded(const QString &path);
+
+    QHash<QString, QPixmap> decodedPixmaps; // Keyed by resource path
+    QHash<QString, QPixmap> scaledPixmaps; // Keyed by resource path, size and device pixel ratio
+    int hits;
+    int misses;
+};
+
+#endif //QT_MINESWEEPER_PIXMAPCACHE_H
@@ -0,0 +1,84 @@
+/**
+ * @file playerview.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the PlayerView class, a read-only view of a Board that shows only what a player
+ *        can see.
+ *
+ * Hidden cells give away nothing: there is no way to ask whether they hold a mine or how many
+ * mines surround them. Bots, the solver and the probability engine only get a PlayerView, so they
+ * cannot cheat, however they are written. The view holds a reference to the board and forwards
+ * every call inline, so it costs nothing to pass around and any Board converts to it implicitly.
+ */
+
+#ifndef QT_MINESWEEPER_PLAYERVIEW_H
+#define QT_MINESWEEPER_PLAYERVIEW_H
+
+#include "board.h"
+
+class PlayerView {
+public:
+
+    PlayerView(const Board &board) : board(board) {} // Implicit on purpose, see above
+
+    int getWidth() const {
+        return board.getWidth();
+    }
+
+    int getHeight() const {
+        return board.getHeight();
+    }
+
+    int getMineCount() const {
+        return board.getMineCount();
+    }
+
+    Topology::Kind getTopology() const {
+        return board.getTopology();
+    }
+
+    bool contains(int x, int y) const {
+        return board.contains(x, y);
+    }
+
+    bool isRevealed(int x, int y) const {
+        return board.isRevealed(x, y);
+    }
+
+    // The number on a revealed safe cell, or -1 for hidden cells and revealed mines
+    int getAdjacentMines(int x, int y) const {
+        return board.isRevealed(x, y) && !board.isMine(x, y) ? board.getAdjacentMines(x, y) : -1;
+    }
+
+    Board::Mark getMark(int x, int y) const {
+        return board.getMark(x, y);
+    }
+
+    // The cells revealed or marked since the board was reset, see Board::getTouchedCells()
+    const std::vector<int> &getTouchedCells() const {
+        return board.getTouchedCells();
+    }
+
+    int getRevealedSafeCells() const {
+        return board.getRevealedSafeCells();
+    }
+
+    // True before the first reveal, which is guaranteed to be safe
+    bool isOpeningPending() const {
+        return board.isOpeningPending();
+    }
+
+    bool isWon() const {
+        return board.isWon();
+    }
+
+    bool isLost() const {
+        return board.isLost();
+    }
+
+private:
+
+    const Board &board;
+};
+
+#endif //QT_MINESWEEPER_PLAYERVIEW_H
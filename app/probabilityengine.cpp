@@ -0,0 +1,546 @@
+/**
+ * @file probabilityengine.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the ProbabilityEngine class, which splits the frontier into independent
+ *        components, enumerates them in parallel and combines them with the interior.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <map>
+#include "probabilityengine.h"
+#include "trace.h"
+
+namespace {
+
+// Binomial coefficients for group sizes; a group lies in the neighbourhood of one cell
+constexpr int MAX_GROUP = Topology::MAX_NEIGHBOURS;
+constexpr auto GROUP_BINOMIALS = [] {
+    std::array<std::array<double, MAX_GROUP + 1>, MAX_GROUP + 1> binomials{};
+    for (int n = 0; n <= MAX_GROUP; n++) {
+        binomials[n][0] = 1;
+        for (int k = 1; k <= n; k++) {
+            binomials[n][k] = binomials[n - 1][k - 1] + (k < n ? binomials[n - 1][k] : 0);
+        }
+    }
+    return binomials;
+}();
+
+// Backtracking search over the number of mines in each group of one component
+struct Enumerator {
+    int groupCount;
+    int maxMines;
+    const std::vector<int> &constraintMines;
+    std::vector<int> groupSizes;
+    std::vector<int> groupStarts; // Offsets into groupConstraints, one past the end included
+    std::vector<int> groupConstraints;
+    std::vector<int> assignedMines; // Per constraint
+    std::vector<int> unassignedCells; // Per constraint
+    std::vector<int> values; // Mines in each group
+    int mines;
+    std::vector<double> &weights;
+    std::vector<double> &groupWeights;
+    std::stop_token stop;
+    long long steps; // Calls of search() so far, plus the groups of every solution recorded
+    bool stopped; // Set once the search ran out of steps or was asked to stop, which ends it
+
+    void search(int position, double weight) {
+        // The stop token is only looked at now and then, since every step is short
+        if (stopped || ++steps > ProbabilityEngine::MAX_SEARCH_STEPS ||
+            (steps % 4096 == 0 && stop.stop_requested())) {
+            stopped = true;
+            return;
+        }
+        if (position == groupCount) {
+            steps += groupCount;
+            weights[mines] += weight;
+            double *row = &groupWeights[static_cast<std::size_t>(mines) * groupCount];
+            for (int i = 0; i < groupCount; i++) {
+                row[i] += weight * values[i] / groupSizes[i];
+            }
+            return;
+        }
+
+        int size = groupSizes[position];
+        for (int value = 0; value <= size && mines + value <= maxMines; value++) {
+            // Assigning the group must leave every constraint it is part of satisfiable
+            bool feasible = true;
+            for (int i = groupStarts[position]; i < groupStarts[position + 1]; i++) {
+                int constraint = groupConstraints[i];
+                unassignedCells[constraint] -= size;
+                assignedMines[constraint] += value;
+                feasible = feasible && assignedMines[constraint] <= constraintMines[constraint] &&
+                           assignedMines[constraint] + unassignedCells[constraint] >= constraintMines[constraint];
+            }
+
+            if (feasible) {
+                values[position] = value;
+                mines += value;
+                search(position + 1, weight * GROUP_BINOMIALS[size][value]);
+                mines -= value;
+            }
+
+            for (int i = groupStarts[position]; i < groupStarts[position + 1]; i++) {
+                int constraint = groupConstraints[i];
+                unassignedCells[constraint] += size;
+                assignedMines[constraint] -= value;
+            }
+        }
+    }
+};
+
+}
+
+/**
+ * @function ProbabilityEngine
+ * @brief Constructs a ProbabilityEngine.
+ *
+ * @param pool The pool the components are enumerated on, or nullptr to enumerate them on the
+ *             calling thread.
+ */
+ProbabilityEngine::ProbabilityEngine(ThreadPool *pool) : pool(pool), width(0), logFactorials(1, 0.0) {}
+
+/**
+ * @function ~ProbabilityEngine
+ * @brief Destructor for ProbabilityEngine.
+ *
+ * The pool is not owned by the engine.
+ */
+ProbabilityEngine::~ProbabilityEngine() = default;
+
+/**
+ * @function compute
+ * @brief Computes the probability of every hidden cell of a board being a mine.
+ *
+ * Only the revealed numbers and the total mine count are used, since the view shows nothing else,
+ * so the result is what a perfect player could know. Marks are ignored.
+ *
+ * If a component takes more than MAX_SEARCH_STEPS steps to enumerate, or the stop token is
+ * triggered, every hidden cell gets the same probability instead, as if nothing had been revealed
+ * next to it.
+ *
+ * @param view The view of the board to analyse.
+ * @param stop Triggered when the result is no longer needed, to return early.
+ * @return True if the probabilities are exact, false if they are the estimate.
+ */
+bool ProbabilityEngine::compute(PlayerView view, std::stop_token stop) {
+    TRACE_SCOPE("ProbabilityEngine::compute");
+    width = view.getWidth();
+    int height = view.getHeight();
+    int cellCount = width * height;
+    if (!topology || topology->getKind() != view.getTopology() || topology->getWidth() != width ||
+        topology->getHeight() != height) {
+        topology = Topology::get(view.getTopology(), width, height);
+    }
+
+    probabilities.assign(cellCount, -1.0);
+    components.clear();
+
+    // Number every hidden cell next to a revealed one and collect the constraints over them
+    std::vector<int> variables(cellCount, -1);
+    std::vector<int> frontier;
+    std::vector<int> constraintStarts(1, 0);
+    std::vector<int> constraintVariables;
+    std::vector<int> constraintMines;
+    int hiddenCells = 0;
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (!view.isRevealed(x, y)) {
+                hiddenCells++;
+                continue;
+            }
+            if (view.getAdjacentMines(x, y) < 0) continue;
+
+            int firstVariable = static_cast<int>(constraintVariables.size());
+            for (int cell: topology->getNeighbours(y * width + x)) {
+                if (view.isRevealed(cell % width, cell / width)) continue;
+
+                if (variables[cell] < 0) {
+                    variables[cell] = static_cast<int>(frontier.size());
+                    frontier.push_back(cell);
+                }
+                constraintVariables.push_back(variables[cell]);
+            }
+
+            if (static_cast<int>(constraintVariables.size()) > firstVariable) {
+                constraintStarts.push_back(static_cast<int>(constraintVariables.size()));
+                constraintMines.push_back(view.getAdjacentMines(x, y));
+            }
+        }
+    }
+
+    if (stop.stop_requested()) {
+        estimateUniformly(view, hiddenCells);
+        return false;
+    }
+
+    auto frontierSize = static_cast<int>(frontier.size());
+    auto constraintCount = static_cast<int>(constraintMines.size());
+
+    // Constraints of every frontier cell, so components can be walked breadth first
+    std::vector<int> variableStarts(frontierSize + 1, 0);
+    for (int variable: constraintVariables) {
+        variableStarts[variable + 1]++;
+    }
+    for (int i = 0; i < frontierSize; i++) {
+        variableStarts[i + 1] += variableStarts[i];
+    }
+    std::vector<int> variableConstraints(constraintVariables.size());
+    std::vector<int> fill(variableStarts.begin(), variableStarts.end() - 1);
+    for (int constraint = 0; constraint < constraintCount; constraint++) {
+        for (int i = constraintStarts[constraint]; i < constraintStarts[constraint + 1]; i++) {
+            variableConstraints[fill[constraintVariables[i]]++] = constraint;
+        }
+    }
+
+    // Cells next to exactly the same revealed numbers are interchangeable, so they are grouped and
+    // only the number of mines in each group is enumerated
+    std::map<std::vector<int>, int> groupsByConstraints;
+    std::vector<int> variableGroups(frontierSize);
+    std::vector<std::vector<int>> groupVariables;
+    for (int variable = 0; variable < frontierSize; variable++) {
+        std::vector<int> key(variableConstraints.begin() + variableStarts[variable],
+                             variableConstraints.begin() + variableStarts[variable + 1]);
+        auto nextGroup = static_cast<int>(groupVariables.size());
+        auto [entry, inserted] = groupsByConstraints.try_emplace(std::move(key), nextGroup);
+        if (inserted) {
+            groupVariables.emplace_back();
+        }
+        variableGroups[variable] = entry->second;
+        groupVariables[entry->second].push_back(variable);
+    }
+    auto groupCount = static_cast<int>(groupVariables.size());
+
+    // Split the groups into components; breadth-first order keeps the groups of a constraint close
+    // together, so the search prunes early
+    std::vector<int> positions(groupCount, -1);
+    std::vector<int> constraintComponent(constraintCount, -1);
+    for (int seed = 0; seed < groupCount; seed++) {
+        if (positions[seed] >= 0) continue;
+
+        Component &component = components.emplace_back();
+        std::vector<int> order(1, seed);
+        std::vector<int> constraints;
+        positions[seed] = 0;
+        auto componentIndex = static_cast<int>(components.size() - 1);
+
+        for (std::size_t next = 0; next < order.size(); next++) {
+            int variable = groupVariables[order[next]].front();
+            for (int i = variableStarts[variable]; i < variableStarts[variable + 1]; i++) {
+                int constraint = variableConstraints[i];
+                if (constraintComponent[constraint] >= 0) continue;
+
+                constraintComponent[constraint] = componentIndex;
+                constraints.push_back(constraint);
+                for (int j = constraintStarts[constraint]; j < constraintStarts[constraint + 1]; j++) {
+                    int group = variableGroups[constraintVariables[j]];
+                    if (positions[group] < 0) {
+                        positions[group] = static_cast<int>(order.size());
+                        order.push_back(group);
+                    }
+                }
+            }
+        }
+
+        component.groupStarts.push_back(0);
+        for (int group: order) {
+            for (int variable: groupVariables[group]) {
+                component.cells.push_back(frontier[variable]);
+            }
+            component.groupStarts.push_back(static_cast<int>(component.cells.size()));
+        }
+        component.constraintStarts.push_back(0);
+        for (int constraint: constraints) {
+            // Every group of the constraint lies in it completely; list each of them once
+            for (int j = constraintStarts[constraint]; j < constraintStarts[constraint + 1]; j++) {
+                int position = positions[variableGroups[constraintVariables[j]]];
+                auto first = component.constraintGroups.begin() + component.constraintStarts.back();
+                if (std::find(first, component.constraintGroups.end(), position) == component.constraintGroups.end()) {
+                    component.constraintGroups.push_back(position);
+                }
+            }
+            component.constraintStarts.push_back(static_cast<int>(component.constraintGroups.size()));
+            component.constraintMines.push_back(constraintMines[constraint]);
+        }
+    }
+
+    // Largest components first, so the long enumerations start before the short ones
+    std::sort(components.begin(), components.end(), [](const Component &a, const Component &b) {
+        return a.cells.size() > b.cells.size();
+    });
+
+    int mineCount = view.getMineCount();
+    auto componentCount = static_cast<int>(components.size());
+    std::vector<char> complete(componentCount);
+    auto enumerateComponent = [&](int i) { complete[i] = enumerate(components[i], mineCount, stop); };
+    if (pool) {
+        pool->parallelFor(componentCount, enumerateComponent);
+    } else {
+        for (int i = 0; i < componentCount; i++) {
+            enumerateComponent(i);
+        }
+    }
+    if (std::find(complete.begin(), complete.end(), 0) != complete.end()) {
+        estimateUniformly(view, hiddenCells);
+        return false;
+    }
+
+    // Relative weight of every total number of frontier mines, from the ways to fill the interior;
+    // there are never more frontier mines than mines
+    int interiorCells = hiddenCells - frontierSize;
+    int maxFrontierMines = std::min(frontierSize, mineCount);
+    std::vector<double> logWeights(maxFrontierMines + 1, -std::numeric_limits<double>::infinity());
+    double maxLogWeight = -std::numeric_limits<double>::infinity();
+    for (int mines = 0; mines <= maxFrontierMines; mines++) {
+        int interiorMines = mineCount - mines;
+        if (interiorMines > interiorCells) continue;
+
+        logWeights[mines] = logBinomial(interiorCells, interiorMines);
+        maxLogWeight = std::max(maxLogWeight, logWeights[mines]);
+    }
+    std::vector<double> frontierWeights(maxFrontierMines + 1, 0.0);
+    for (int mines = 0; mines <= maxFrontierMines; mines++) {
+        if (logWeights[mines] > -std::numeric_limits<double>::infinity()) {
+            frontierWeights[mines] = std::exp(logWeights[mines] - maxLogWeight);
+        }
+    }
+
+    // caps[i]: the most mines the components before i can hold, which is also the last index of the
+    // weights over them; sums that would go past it have no weight, since they exceed the mine count
+    std::vector<int> caps(componentCount + 1, 0);
+    for (int i = 0; i < componentCount; i++) {
+        caps[i + 1] = std::min(caps[i] + static_cast<int>(components[i].cells.size()), mineCount);
+    }
+
+    // suffixWeights[i][s]: weight of s mines in the components before i, summed over the mines of
+    // the components from i on
+    std::vector<std::vector<double>> suffixWeights(componentCount + 1);
+    suffixWeights[componentCount] = frontierWeights;
+    for (int i = componentCount - 1; i >= 0; i--) {
+        const std::vector<double> &weights = components[i].weights;
+        const std::vector<double> &next = suffixWeights[i + 1];
+        std::vector<double> &current = suffixWeights[i];
+        current.assign(caps[i] + 1, 0.0);
+        for (int s = 0; s <= caps[i]; s++) {
+            auto end = static_cast<int>(std::min<std::size_t>(weights.size(), caps[i + 1] - s + 1));
+            for (int k = 0; k < end; k++) {
+                current[s] += weights[k] * next[s + k];
+            }
+        }
+    }
+
+    double total = suffixWeights[0][0];
+    if (!(total > 0)) {
+        // The revealed numbers contradict the mine count
+        estimateUniformly(view, hiddenCells);
+        return false;
+    }
+
+    // prefixWeights[s]: weight of s mines in the components before the current one
+    std::vector<double> prefixWeights(1, 1.0);
+    for (int i = 0; i < componentCount; i++) {
+        Component &component = components[i];
+        auto maxMines = static_cast<int>(component.weights.size() - 1);
+        const std::vector<double> &suffix = suffixWeights[i + 1];
+
+        auto groups = static_cast<int>(component.groupStarts.size() - 1);
+        std::vector<double> groupProbabilities(groups, 0.0);
+
+        for (int k = 0; k <= maxMines; k++) {
+            if (component.weights[k] == 0) continue;
+
+            double others = 0;
+            for (int s = 0; s <= caps[i] && s + k <= caps[i + 1]; s++) {
+                others += prefixWeights[s] * suffix[s + k];
+            }
+            for (int group = 0; group < groups; group++) {
+                groupProbabilities[group] += component.groupWeights[static_cast<std::size_t>(k) * groups + group] *
+                                             others / total;
+            }
+        }
+
+        for (int group = 0; group < groups; group++) {
+            for (int j = component.groupStarts[group]; j < component.groupStarts[group + 1]; j++) {
+                probabilities[component.cells[j]] = groupProbabilities[group];
+            }
+        }
+
+        std::vector<double> next(caps[i + 1] + 1, 0.0);
+        for (int s = 0; s <= caps[i]; s++) {
+            for (int k = 0; k <= maxMines && s + k <= caps[i + 1]; k++) {
+                next[s + k] += prefixWeights[s] * component.weights[k];
+            }
+        }
+        prefixWeights.swap(next);
+    }
+
+    if (interiorCells > 0) {
+        double interiorMines = 0;
+        for (int mines = 0; mines <= maxFrontierMines; mines++) {
+            interiorMines += prefixWeights[mines] * frontierWeights[mines] * (mineCount - mines);
+        }
+        double interiorProbability = interiorMines / total / interiorCells;
+
+        for (int cell = 0; cell < cellCount; cell++) {
+            if (variables[cell] < 0 && !view.isRevealed(cell % width, cell / width)) {
+                probabilities[cell] = interiorProbability;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @function getProbability
+ * @brief Returns the probability of a cell being a mine, as of the last call to compute().
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The probability in [0, 1], or -1 if the cell is revealed.
+ */
+double ProbabilityEngine::getProbability(int x, int y) const {
+    return probabilities[y * width + x];
+}
+
+/**
+ * @function getProbabilities
+ * @brief Returns the probabilities of all cells, as of the last call to compute().
+ *
+ * @return One probability per cell, indexed like the board, with -1 for revealed cells.
+ */
+const std::vector<double> &ProbabilityEngine::getProbabilities() const {
+    return probabilities;
+}
+
+/**
+ * @function findBestGuess
+ * @brief Returns the hidden cell that is least likely to be a mine.
+ *
+ * @return The board index of the cell, or -1 if every cell is revealed.
+ */
+int ProbabilityEngine::findBestGuess() const {
+    int best = -1;
+    for (int cell = 0; cell < static_cast<int>(probabilities.size()); cell++) {
+        if (probabilities[cell] >= 0 && (best < 0 || probabilities[cell] < probabilities[best])) {
+            best = cell;
+        }
+    }
+    return best;
+}
+
+/**
+ * @function getComponentCount
+ * @brief Returns the number of independent frontier components found by the last call to compute().
+ *
+ * @return The number of components.
+ */
+int ProbabilityEngine::getComponentCount() const {
+    return static_cast<int>(components.size());
+}
+
+/**
+ * @function enumerate
+ * @brief Enumerates every assignment of mines to a component that meets all of its constraints.
+ *
+ * Fills the weights and group weights of the component with the number of solutions per mine
+ * count, where an assignment of t mines to a group of g cells stands for C(g, t) solutions. The
+ * weights are then scaled so they add up to 1; only their ratios matter when the components are
+ * combined, and the scaling keeps the numbers in range for large components.
+ *
+ * @param component The component to enumerate.
+ * @param maxMines The mine count of the whole board, which no component can exceed.
+ * @param stop Triggered when the result is no longer needed.
+ * @return True if every assignment was enumerated, false if the search took more than
+ *         MAX_SEARCH_STEPS steps or was stopped, which leaves the weights incomplete.
+ */
+bool ProbabilityEngine::enumerate(Component &component, int maxMines, std::stop_token stop) {
+    auto size = static_cast<int>(component.cells.size());
+    auto groupCount = static_cast<int>(component.groupStarts.size() - 1);
+    auto constraintCount = static_cast<int>(component.constraintMines.size());
+    int componentMines = std::min(maxMines, size);
+
+    component.weights.assign(componentMines + 1, 0.0);
+    component.groupWeights.assign(static_cast<std::size_t>(componentMines + 1) * groupCount, 0.0);
+
+    Enumerator enumerator{groupCount, componentMines, component.constraintMines, {}, {}, {}, {}, {},
+                          std::vector<int>(groupCount, 0), 0, component.weights, component.groupWeights,
+                          std::move(stop), 0, false};
+
+    for (int group = 0; group < groupCount; group++) {
+        enumerator.groupSizes.push_back(component.groupStarts[group + 1] - component.groupStarts[group]);
+    }
+    enumerator.groupStarts.assign(groupCount + 1, 0);
+    for (int group: component.constraintGroups) {
+        enumerator.groupStarts[group + 1]++;
+    }
+    for (int i = 0; i < groupCount; i++) {
+        enumerator.groupStarts[i + 1] += enumerator.groupStarts[i];
+    }
+    enumerator.groupConstraints.resize(component.constraintGroups.size());
+    std::vector<int> fill(enumerator.groupStarts.begin(), enumerator.groupStarts.end() - 1);
+    for (int constraint = 0; constraint < constraintCount; constraint++) {
+        int cells = 0;
+        for (int i = component.constraintStarts[constraint]; i < component.constraintStarts[constraint + 1]; i++) {
+            int group = component.constraintGroups[i];
+            enumerator.groupConstraints[fill[group]++] = constraint;
+            cells += enumerator.groupSizes[group];
+        }
+        enumerator.unassignedCells.push_back(cells);
+    }
+    enumerator.assignedMines.assign(constraintCount, 0);
+
+    enumerator.search(0, 1.0);
+    if (enumerator.stopped) {
+        return false;
+    }
+
+    double solutions = 0;
+    for (double weight: component.weights) {
+        solutions += weight;
+    }
+    if (solutions > 0) {
+        for (double &weight: component.weights) {
+            weight /= solutions;
+        }
+        for (double &weight: component.groupWeights) {
+            weight /= solutions;
+        }
+    }
+    return true;
+}
+
+/**
+ * @function estimateUniformly
+ * @brief Gives every hidden cell the same share of the mines.
+ *
+ * Used when the revealed numbers cannot be taken into account, because they contradict the mine
+ * count or the search took too long.
+ *
+ * @param view The view of the board being analysed.
+ * @param hiddenCells The number of hidden cells of the board.
+ */
+void ProbabilityEngine::estimateUniformly(PlayerView view, int hiddenCells) {
+    double probability = hiddenCells ? static_cast<double>(view.getMineCount()) / hiddenCells : 0.0;
+    for (int cell = 0; cell < static_cast<int>(probabilities.size()); cell++) {
+        probabilities[cell] = view.isRevealed(cell % width, cell / width) ? -1.0 : probability;
+    }
+}
+
+/**
+ * @function logBinomial
+ * @brief Returns log(C(n, k)) from the table of log-factorials, growing the table if needed.
+ *
+ * @param n The size of the set, at least 0.
+ * @param k The size of the subset, in [0, n].
+ * @return The natural logarithm of the binomial coefficient.
+ */
+double ProbabilityEngine::logBinomial(int n, int k) {
+    for (auto i = static_cast<int>(logFactorials.size()); i <= n; i++) {
+        logFactorials.push_back(logFactorials.back() + std::log(static_cast<double>(i)));
+    }
+    return logFactorials[n] - logFactorials[k] - logFactorials[n - k];
+}
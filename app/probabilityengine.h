@@ -0,0 +1,77 @@
+/**
+ * @file probabilityengine.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the ProbabilityEngine class that computes the exact chance of every hidden cell
+ *        being a mine.
+ *
+ * The hidden cells next to a revealed number form the frontier; all other hidden cells are the
+ * interior, about which the numbers say nothing. The frontier is split into components that share
+ * no constraint. Cells next to exactly the same numbers are merged into a group, and each component
+ * is enumerated on its own over the number of mines per group, with backtracking that drops a
+ * branch as soon as one of its constraints can no longer be met. Components are independent, so
+ * they are enumerated in parallel. Their mine count distributions are then combined, weighting
+ * every total number of frontier mines f by the C(interior, mines - f) ways to place the remaining
+ * mines in the interior. The binomials are taken from a table of log-factorials that is kept
+ * between calls. No distribution is kept past the mine count of the board, which bounds the cost of
+ * combining them on large frontiers. A component whose search runs too long, or a stop request,
+ * ends the computation early with an estimate that treats every hidden cell alike.
+ */
+
+#ifndef QT_MINESWEEPER_PROBABILITYENGINE_H
+#define QT_MINESWEEPER_PROBABILITYENGINE_H
+
+#include <memory>
+#include <stop_token>
+#include <vector>
+#include "playerview.h"
+#include "threadpool.h"
+#include "topology.h"
+
+class ProbabilityEngine {
+public:
+
+    static constexpr long long MAX_SEARCH_STEPS = 1LL << 24; // Per component, before compute() gives up
+
+    explicit ProbabilityEngine(ThreadPool *pool = nullptr);
+
+    ~ProbabilityEngine();
+
+    bool compute(PlayerView view, std::stop_token stop = {});
+
+    double getProbability(int x, int y) const;
+
+    const std::vector<double> &getProbabilities() const;
+
+    int findBestGuess() const;
+
+    int getComponentCount() const;
+
+private:
+
+    // A set of frontier cells connected through shared constraints
+    struct Component {
+        std::vector<int> cells; // Board indices, grouped and in the order the groups are assigned
+        std::vector<int> groupStarts; // Offsets into cells, one past the end included
+        std::vector<int> constraintStarts; // Offsets into constraintGroups, one past the end included
+        std::vector<int> constraintGroups; // Positions of groups
+        std::vector<int> constraintMines;
+        std::vector<double> weights; // weights[k]: share of the solutions with k mines, k up to the mine count
+        std::vector<double> groupWeights; // groupWeights[k * groups + g]: that share times the mine share of g
+    };
+
+    static bool enumerate(Component &component, int maxMines, std::stop_token stop);
+
+    void estimateUniformly(PlayerView view, int hiddenCells);
+
+    double logBinomial(int n, int k);
+
+    ThreadPool *pool;
+    int width;
+    std::shared_ptr<const Topology> topology; // Kept between calls, so a table is built once per board shape
+    std::vector<double> probabilities; // One per cell, -1 for revealed cells
+    std::vector<Component> components;
+    std::vector<double> logFactorials; // logFactorials[n] = log(n!), grown on demand
+};
+
+#endif //QT_MINESWEEPER_PROBABILITYENGINE_H
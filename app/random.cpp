@@ -0,0 +1,123 @@
+/**
+ * @file random.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the Random class (xoshiro256** with SplitMix64 seeding).
+ */
+
+#include "random.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace {
+
+std::uint64_t rotateLeft(std::uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+// Returns the high word of the 128-bit product of a and b, and stores the low word in low
+std::uint64_t multiplyHigh(std::uint64_t a, std::uint64_t b, std::uint64_t &low) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    low = static_cast<std::uint64_t>(product);
+    return static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    std::uint64_t high;
+    low = _umul128(a, b, &high);
+    return high;
+#else
+    // Schoolbook multiplication on 32-bit halves
+    std::uint64_t aLow = a & 0xFFFFFFFFULL;
+    std::uint64_t aHigh = a >> 32;
+    std::uint64_t bLow = b & 0xFFFFFFFFULL;
+    std::uint64_t bHigh = b >> 32;
+
+    std::uint64_t lowLow = aLow * bLow;
+    std::uint64_t highLow = aHigh * bLow;
+    std::uint64_t lowHigh = aLow * bHigh;
+    std::uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFULL) + (lowHigh & 0xFFFFFFFFULL);
+
+    low = (middle << 32) | (lowLow & 0xFFFFFFFFULL);
+    return aHigh * bHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+}
+
+}
+
+/**
+ * @function Random
+ * @brief Constructs a generator from a 64-bit seed.
+ *
+ * The four words of state are filled from consecutive SplitMix64 outputs, so they can never all
+ * be zero.
+ *
+ * @param seed The seed. Equal seeds produce equal sequences.
+ */
+Random::Random(std::uint64_t seed) {
+    for (std::uint64_t &word: state) {
+        seed += 0x9E3779B97F4A7C15ULL;
+        word = mix(seed);
+    }
+}
+
+/**
+ * @function next
+ * @brief Returns the next 64 random bits.
+ *
+ * @return A uniformly distributed 64-bit value.
+ */
+std::uint64_t Random::next() {
+    std::uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+    std::uint64_t t = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotateLeft(state[3], 45);
+
+    return result;
+}
+
+/**
+ * @function nextBelow
+ * @brief Returns a uniformly distributed value in [0, bound).
+ *
+ * Uses Lemire's method: the high word of a 128-bit product is the result, and the rare draws that
+ * would make some results more likely than others are rejected. The product is computed with the
+ * widest multiplication the compiler offers, so every toolchain draws the same values.
+ *
+ * @param bound The exclusive upper bound. Must be greater than zero.
+ * @return A value in [0, bound).
+ */
+std::uint64_t Random::nextBelow(std::uint64_t bound) {
+    std::uint64_t low;
+    std::uint64_t high = multiplyHigh(next(), bound, low);
+
+    if (low < bound) {
+        std::uint64_t threshold = -bound % bound;
+        while (low < threshold) {
+            high = multiplyHigh(next(), bound, low);
+        }
+    }
+
+    return high;
+}
+
+/**
+ * @function mix
+ * @brief Scrambles a 64-bit value with the SplitMix64 finaliser.
+ *
+ * Also useful on its own to derive independent seeds from a seed and a counter.
+ *
+ * @param value The value to scramble.
+ * @return The scrambled value.
+ */
+std::uint64_t Random::mix(std::uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
@@ -0,0 +1,34 @@
+/**
+ * @file random.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the Random class, a small and fast seedable pseudo-random number generator.
+ *
+ * Random implements xoshiro256** seeded through SplitMix64, so any 64-bit seed (including zero)
+ * gives a well-mixed state. Bounded numbers are drawn with Lemire's multiply-and-reject method,
+ * which is unbiased and almost never needs more than one draw. The same seed always produces the
+ * same sequence on every platform, which makes boards reproducible.
+ */
+
+#ifndef QT_MINESWEEPER_RANDOM_H
+#define QT_MINESWEEPER_RANDOM_H
+
+#include <cstdint>
+
+class Random {
+public:
+
+    explicit Random(std::uint64_t seed);
+
+    std::uint64_t next();
+
+    std::uint64_t nextBelow(std::uint64_t bound);
+
+    static std::uint64_t mix(std::uint64_t value);
+
+private:
+
+    std::uint64_t state[4];
+};
+
+#endif //QT_MINESWEEPER_RANDOM_H
@@ -0,0 +1,433 @@
+/**
+ * @file replay.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the Replay class, which encodes the moves of a game as varints and
+ *        stores the cells they changed at regular checkpoints.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include "random.h"
+#include "replay.h"
+
+// The header and the checkpoint table are written as they are laid out in memory
+static_assert(std::endian::native == std::endian::little, "Replays are only supported on little-endian platforms");
+
+namespace {
+
+void writeVarint(std::vector<std::uint8_t> &out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+// Reads the varint at offset and moves past it; false if it runs past the end or beyond 64 bits
+bool readVarint(const std::vector<std::uint8_t> &in, std::uint32_t &offset, std::uint64_t &value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (offset >= in.size()) {
+            return false;
+        }
+        std::uint8_t byte = in[offset++];
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Small differences of either sign get small codes: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+std::uint64_t zigzag(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+std::int64_t unzigzag(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+std::uint64_t hashBytes(std::uint64_t hash, const void *data, std::size_t size) {
+    const auto *bytes = static_cast<const std::uint8_t *>(data);
+    for (std::size_t i = 0; i < size; i += sizeof(std::uint64_t)) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, bytes + i, std::min(sizeof word, size - i));
+        hash = Random::mix(hash ^ word);
+    }
+    return Random::mix(hash ^ size);
+}
+
+}
+
+/**
+ * @function Replay
+ * @brief Starts the replay of a game on a freshly generated board.
+ *
+ * The board must come straight from BoardGenerator::generate(), or from a no-guess generator that
+ * revealed its start cell, so that ReplayEngine can generate it again from its seed.
+ *
+ * @param board The board the game is played on, before the first move.
+ */
+Replay::Replay(const Board &board) {
+    std::memcpy(header.magic, MAGIC, sizeof MAGIC);
+    header.version = VERSION;
+    header.headerSize = sizeof(Header);
+    header.width = static_cast<std::uint32_t>(board.getWidth());
+    header.height = static_cast<std::uint32_t>(board.getHeight());
+    header.mineCount = static_cast<std::uint32_t>(board.getMineCount());
+    header.topology = static_cast<std::uint8_t>(board.getTopology());
+    header.seed = board.getSeed();
+    header.layoutHash = hashLayout(board);
+
+    // A no-guess board starts with its opening cleared and the start cell revealed
+    const std::vector<int> &touched = board.getTouchedCells();
+    header.startCell = !board.isOpeningPending() && !touched.empty() ? touched.front() : -1;
+}
+
+/**
+ * @function record
+ * @brief Appends a move that has just been applied to the board.
+ *
+ * Every CHECKPOINT_INTERVAL moves the cells changed since the previous checkpoint are stored. They
+ * are taken from the touched list of the board, so collecting them takes time in proportion to
+ * the cells the moves changed, not to the size of the board.
+ *
+ * @param board The board the replay was started on, after the move.
+ * @param move The move. Its time must not be earlier than the one of the previous move.
+ */
+void Replay::record(const Board &board, const Move &move) {
+    std::uint32_t time = std::max(move.time, end.time);
+    writeVarint(stream, static_cast<std::uint64_t>(time - end.time) << 2 | static_cast<std::uint64_t>(move.type));
+    writeVarint(stream, zigzag(static_cast<std::int64_t>(move.cell) - end.cell));
+    end = {end.move + 1, static_cast<std::uint32_t>(stream.size()), time, move.cell};
+    header.flags = board.isWon() ? FLAG_WON : board.isLost() ? FLAG_LOST : 0;
+
+    // Reveals add to the touched list, but a mark only does when it is put on an unmarked cell
+    const std::vector<int> &touched = board.getTouchedCells();
+    changedCells.insert(changedCells.end(), touched.begin() + static_cast<std::ptrdiff_t>(touchedSeen), touched.end());
+    touchedSeen = touched.size();
+    if (move.type == MoveType::FLAG || move.type == MoveType::CYCLE_MARK) {
+        changedCells.push_back(move.cell);
+    }
+
+    if (end.move % CHECKPOINT_INTERVAL != 0) {
+        return;
+    }
+
+    std::sort(changedCells.begin(), changedCells.end());
+    changedCells.erase(std::unique(changedCells.begin(), changedCells.end()), changedCells.end());
+    checkpoints.push_back({end, static_cast<std::uint32_t>(states.size()),
+                           static_cast<std::uint32_t>(changedCells.size())});
+
+    int previous = 0;
+    for (int cell: changedCells) {
+        writeVarint(states, static_cast<std::uint64_t>(cell - previous) << 2 | getCellState(board, cell));
+        previous = cell;
+    }
+    changedCells.clear();
+}
+
+/**
+ * @function save
+ * @brief Writes the replay to a file.
+ *
+ * An existing file is overwritten.
+ *
+ * @param path The path of the file.
+ * @return True if the file was written, false if it could not be.
+ */
+bool Replay::save(const std::string &path) const {
+    static_assert(sizeof(Header) == 80 && std::is_trivially_copyable_v<Header>);
+    static_assert(sizeof(Checkpoint) == 24 && std::is_trivially_copyable_v<Checkpoint>);
+
+    Header written = header;
+    written.moveCount = end.move;
+    written.checkpointCount = static_cast<std::uint32_t>(checkpoints.size());
+    written.streamSize = static_cast<std::uint32_t>(stream.size());
+    written.stateSize = static_cast<std::uint32_t>(states.size());
+    written.checksum = checksum(written);
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&written), sizeof written);
+    out.write(reinterpret_cast<const char *>(stream.data()), static_cast<std::streamsize>(stream.size()));
+    out.write(reinterpret_cast<const char *>(checkpoints.data()),
+              static_cast<std::streamsize>(checkpoints.size() * sizeof(Checkpoint)));
+    out.write(reinterpret_cast<const char *>(states.data()), static_cast<std::streamsize>(states.size()));
+    out.close();
+    return !out.fail();
+}
+
+/**
+ * @function load
+ * @brief Reads a replay written by save().
+ *
+ * Every move and checkpoint is decoded and checked once, so playing the replay back can never read
+ * out of bounds or reach a cell that is not on the board.
+ *
+ * @param path The path of the file.
+ * @return The replay, or nothing if the file cannot be read, is not a replay of this version or is
+ *         corrupt.
+ */
+std::optional<Replay> Replay::load(const std::string &path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        return std::nullopt;
+    }
+
+    auto size = static_cast<std::uint64_t>(in.tellg());
+    Replay replay;
+    in.seekg(0);
+    if (size < sizeof(Header) || !in.read(reinterpret_cast<char *>(&replay.header), sizeof(Header))) {
+        return std::nullopt;
+    }
+
+    const Header &header = replay.header;
+    std::uint64_t tableSize = static_cast<std::uint64_t>(header.checkpointCount) * sizeof(Checkpoint);
+    if (size != sizeof(Header) + header.streamSize + tableSize + header.stateSize) {
+        return std::nullopt;
+    }
+
+    replay.stream.resize(header.streamSize);
+    replay.checkpoints.resize(header.checkpointCount);
+    replay.states.resize(header.stateSize);
+    in.read(reinterpret_cast<char *>(replay.stream.data()), header.streamSize);
+    in.read(reinterpret_cast<char *>(replay.checkpoints.data()),
+            static_cast<std::streamsize>(header.checkpointCount * sizeof(Checkpoint)));
+    in.read(reinterpret_cast<char *>(replay.states.data()), header.stateSize);
+    if (!in || !replay.validate()) {
+        return std::nullopt;
+    }
+    return replay;
+}
+
+/**
+ * @function getConfig
+ * @brief Returns the size, mine count and topology of the board.
+ *
+ * @return The board configuration.
+ */
+BoardConfig Replay::getConfig() const {
+    return {static_cast<int>(header.width), static_cast<int>(header.height), static_cast<int>(header.mineCount),
+            static_cast<Topology::Kind>(header.topology)};
+}
+
+/**
+ * @function getSeed
+ * @brief Returns the seed the board was generated from.
+ *
+ * @return The seed.
+ */
+std::uint64_t Replay::getSeed() const {
+    return header.seed;
+}
+
+/**
+ * @function getMoveCount
+ * @brief Returns the number of recorded moves.
+ *
+ * @return The number of moves.
+ */
+int Replay::getMoveCount() const {
+    return static_cast<int>(end.move);
+}
+
+/**
+ * @function getDuration
+ * @brief Returns the time of the last move.
+ *
+ * @return Milliseconds from the start of the game to the last move.
+ */
+std::uint32_t Replay::getDuration() const {
+    return end.time;
+}
+
+/**
+ * @function isWon
+ * @brief Returns true if the game was won by the last move.
+ *
+ * @return True if the game was won.
+ */
+bool Replay::isWon() const {
+    return header.flags & FLAG_WON;
+}
+
+/**
+ * @function isLost
+ * @brief Returns true if the game was lost by the last move.
+ *
+ * @return True if the game was lost.
+ */
+bool Replay::isLost() const {
+    return header.flags & FLAG_LOST;
+}
+
+/**
+ * @function read
+ * @brief Decodes the move at a cursor and moves the cursor past it.
+ *
+ * @param cursor A cursor before one of the recorded moves: a default one for the first move, or
+ *               one that read() has moved along.
+ * @return The move.
+ */
+Replay::Move Replay::read(Cursor &cursor) const {
+    std::uint64_t head = 0;
+    std::uint64_t delta = 0;
+    readVarint(stream, cursor.offset, head);
+    readVarint(stream, cursor.offset, delta);
+
+    cursor.move++;
+    cursor.time += static_cast<std::uint32_t>(head >> 2);
+    cursor.cell += static_cast<std::int32_t>(unzigzag(delta));
+    return {static_cast<MoveType>(head & 3), cursor.cell, cursor.time};
+}
+
+/**
+ * @function validate
+ * @brief Checks a replay read from a file and finds the end of its moves.
+ *
+ * @return True if the header, the checksum, every move and every checkpoint are consistent.
+ */
+bool Replay::validate() {
+    if (std::memcmp(header.magic, MAGIC, sizeof MAGIC) != 0 || header.version != VERSION ||
+        header.headerSize != sizeof(Header)) {
+        return false;
+    }
+
+    BoardConfig config = getConfig();
+    long long cellCount = config.getCellCount();
+    if (!config.isValid() || header.topology > static_cast<std::uint8_t>(Topology::Kind::HEX) ||
+        header.startCell < -1 || header.startCell >= cellCount || (header.flags & ~(FLAG_WON | FLAG_LOST)) ||
+        header.checkpointCount != header.moveCount / CHECKPOINT_INTERVAL || checksum(header) != header.checksum) {
+        return false;
+    }
+
+    // Every move stays on the board, and every checkpoint points at the move it was taken after
+    Cursor cursor;
+    while (cursor.move < header.moveCount) {
+        std::uint64_t head = 0;
+        std::uint64_t delta = 0;
+        if (!readVarint(stream, cursor.offset, head) || !readVarint(stream, cursor.offset, delta)) {
+            return false;
+        }
+
+        std::int64_t cell = cursor.cell + unzigzag(delta);
+        std::uint64_t time = cursor.time + (head >> 2);
+        if (cell < 0 || cell >= cellCount || time > UINT32_MAX) {
+            return false;
+        }
+        cursor = {cursor.move + 1, cursor.offset, static_cast<std::uint32_t>(time), static_cast<std::int32_t>(cell)};
+
+        if (cursor.move % CHECKPOINT_INTERVAL == 0) {
+            const Cursor &stored = checkpoints[cursor.move / CHECKPOINT_INTERVAL - 1].cursor;
+            if (stored.move != cursor.move || stored.offset != cursor.offset || stored.time != cursor.time ||
+                stored.cell != cursor.cell) {
+                return false;
+            }
+        }
+    }
+    if (cursor.offset != stream.size()) {
+        return false;
+    }
+    end = cursor;
+
+    // The changes follow each other, and each lists distinct cells of the board in increasing order
+    std::uint32_t offset = 0;
+    for (const Checkpoint &checkpoint: checkpoints) {
+        if (checkpoint.stateOffset != offset) {
+            return false;
+        }
+
+        std::uint64_t previous = 0;
+        for (std::uint32_t i = 0; i < checkpoint.stateCells; i++) {
+            std::uint64_t entry = 0;
+            if (!readVarint(states, offset, entry)) {
+                return false;
+            }
+            std::uint64_t cell = previous + (entry >> 2);
+            if (cell >= static_cast<std::uint64_t>(cellCount) || (i > 0 && cell == previous)) {
+                return false;
+            }
+            previous = cell;
+        }
+    }
+    return offset == states.size();
+}
+
+/**
+ * @function getCellState
+ * @brief Returns what a player sees of a cell.
+ *
+ * @param board The board.
+ * @param cell The board index of the cell.
+ * @return Whether the cell is revealed, flagged, question-marked or neither.
+ */
+Replay::CellState Replay::getCellState(const Board &board, int cell) {
+    int x = cell % board.getWidth();
+    int y = cell / board.getWidth();
+
+    if (board.isRevealed(x, y)) {
+        return REVEALED;
+    }
+    switch (board.getMark(x, y)) {
+        case Board::Mark::FLAGGED:
+            return FLAGGED;
+        case Board::Mark::QUESTIONED:
+            return QUESTIONED;
+        default:
+            return HIDDEN;
+    }
+}
+
+/**
+ * @function readState
+ * @brief Decodes the cells that changed between the previous checkpoint and this one.
+ *
+ * @param checkpoint The checkpoint.
+ * @param state Receives cell << 2 | CellState for every changed cell, in increasing order.
+ */
+void Replay::readState(const Checkpoint &checkpoint, std::vector<std::uint32_t> &state) const {
+    state.clear();
+    std::uint32_t offset = checkpoint.stateOffset;
+    std::uint32_t cell = 0;
+
+    for (std::uint32_t i = 0; i < checkpoint.stateCells; i++) {
+        std::uint64_t entry = 0;
+        readVarint(states, offset, entry);
+        cell += static_cast<std::uint32_t>(entry >> 2);
+        state.push_back(cell << 2 | static_cast<std::uint32_t>(entry & 3));
+    }
+}
+
+/**
+ * @function hashLayout
+ * @brief Hashes the mines of a board.
+ *
+ * @param board The board.
+ * @return A hash of its mine plane.
+ */
+std::uint64_t Replay::hashLayout(const Board &board) {
+    return hashBytes(0, board.getMinePlane(),
+                     static_cast<std::size_t>(board.getWordsPerRow()) * board.getHeight() * sizeof(std::uint64_t));
+}
+
+/**
+ * @function checksum
+ * @brief Computes the checksum of the file the replay is saved as.
+ *
+ * @param unsummed The header as it is written; its checksum field is ignored.
+ * @return The checksum.
+ */
+std::uint64_t Replay::checksum(const Header &unsummed) const {
+    Header zeroed = unsummed;
+    zeroed.checksum = 0;
+
+    std::uint64_t hash = hashBytes(0, &zeroed, sizeof zeroed);
+    hash = hashBytes(hash, stream.data(), stream.size());
+    hash = hashBytes(hash, checkpoints.data(), checkpoints.size() * sizeof(Checkpoint));
+    return hashBytes(hash, states.data(), states.size());
+}
@@ -0,0 +1,142 @@
+/**
+ * @file replay.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the Replay class, a compact log of a game that can be played back move by move.
+ *
+ * A replay holds the seed the board was generated from and the moves of the player, each as a pair
+ * of varints: the time since the previous move shifted left past the two bits of the move type, and
+ * the zigzag-encoded difference to the cell of the previous move. Moves of a person usually take
+ * three or four bytes, moves of a bot two or three. Every CHECKPOINT_INTERVAL moves a checkpoint
+ * stores the position in the move stream and the cells that changed since the previous checkpoint,
+ * sorted and gap-encoded as varints with their new state, so together the checkpoints cost about as
+ * much as the cells the game touched, and playback can start from the nearest one instead of the
+ * first move. The file is a fixed header followed by the move stream, the checkpoint table and the
+ * checkpoint states; a checksum covers all of them, and the mine plane of the generated board is
+ * hashed, so a replay that no longer matches the board generator is detected instead of played back
+ * wrong. ReplayEngine plays replays back.
+ */
+
+#ifndef QT_MINESWEEPER_REPLAY_H
+#define QT_MINESWEEPER_REPLAY_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include "board.h"
+#include "boardconfig.h"
+
+class Replay {
+public:
+
+    enum class MoveType : std::uint8_t {
+        REVEAL,
+        CHORD,
+        FLAG, // Toggles the flag, as bots do
+        CYCLE_MARK // Steps through flag, question mark and no mark, as the player does
+    };
+
+    struct Move {
+        MoveType type;
+        int cell;
+        std::uint32_t time; // Milliseconds since the game started
+    };
+
+    // Position in the move stream, and the values the next move is encoded relative to
+    struct Cursor {
+        std::uint32_t move = 0;
+        std::uint32_t offset = 0;
+        std::uint32_t time = 0;
+        std::int32_t cell = 0;
+    };
+
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr int CHECKPOINT_INTERVAL = 256; // Moves between two stored board states
+
+    explicit Replay(const Board &board);
+
+    void record(const Board &board, const Move &move);
+
+    bool save(const std::string &path) const;
+
+    static std::optional<Replay> load(const std::string &path);
+
+    BoardConfig getConfig() const;
+
+    std::uint64_t getSeed() const;
+
+    int getMoveCount() const;
+
+    std::uint32_t getDuration() const;
+
+    bool isWon() const;
+
+    bool isLost() const;
+
+    Move read(Cursor &cursor) const;
+
+private:
+
+    friend class ReplayEngine; // Restores and checks the checkpoints
+
+    enum CellState : std::uint32_t {
+        REVEALED,
+        FLAGGED,
+        QUESTIONED,
+        HIDDEN // Hidden and not marked
+    };
+
+    struct Checkpoint {
+        Cursor cursor; // After the first cursor.move moves
+        std::uint32_t stateOffset; // Into states, where the cells changed since the previous checkpoint start
+        std::uint32_t stateCells;
+    };
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t headerSize;
+        std::uint32_t width;
+        std::uint32_t height;
+        std::uint32_t mineCount;
+        std::uint8_t topology;
+        std::uint8_t flags; // FLAG_WON, FLAG_LOST
+        std::uint16_t reserved;
+        std::uint64_t seed;
+        std::uint64_t layoutHash; // Of the mine plane of the generated board
+        std::int32_t startCell; // Cell revealed when the board was generated, -1 if there is none
+        std::uint32_t moveCount;
+        std::uint32_t checkpointCount;
+        std::uint32_t streamSize;
+        std::uint32_t stateSize;
+        std::uint32_t reserved2;
+        std::uint64_t checksum; // Of the header with this field zero, then of the stream, table and states
+    };
+
+    static constexpr char MAGIC[8] = {'M', 'S', 'W', 'P', 'R', 'P', 'L', 'Y'};
+    static constexpr std::uint8_t FLAG_WON = 0x01;
+    static constexpr std::uint8_t FLAG_LOST = 0x02;
+
+    Replay() = default;
+
+    bool validate();
+
+    static CellState getCellState(const Board &board, int cell);
+
+    void readState(const Checkpoint &checkpoint, std::vector<std::uint32_t> &state) const;
+
+    static std::uint64_t hashLayout(const Board &board);
+
+    std::uint64_t checksum(const Header &unsummed) const;
+
+    Header header{};
+    Cursor end; // After the last recorded move
+    std::vector<std::uint8_t> stream;
+    std::vector<Checkpoint> checkpoints;
+    std::vector<std::uint8_t> states;
+    std::vector<int> changedCells; // Cells changed since the last checkpoint, possibly repeated
+    std::size_t touchedSeen = 0; // Entries of the touched list of the board already in changedCells
+};
+
+#endif //QT_MINESWEEPER_REPLAY_H
@@ -0,0 +1,248 @@
+/**
+ * @file replayengine.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the ReplayEngine class, which regenerates the board of a replay and
+ *        plays its moves, seeking through the checkpoints.
+ */
+
+#include <algorithm>
+#include <iterator>
+#include "boardgenerator.h"
+#include "replayengine.h"
+#include "strategy.h"
+#include "trace.h"
+
+namespace {
+
+Board makeBoard(const BoardConfig &config) {
+    return {config.width, config.height, config.mineCount, config.topology};
+}
+
+}
+
+/**
+ * @function ReplayEngine
+ * @brief Generates the board of a replay and stands before its first move.
+ *
+ * @param replay The replay to play back. It must outlive the engine.
+ */
+ReplayEngine::ReplayEngine(const Replay &replay)
+        : replay(replay), initial(makeBoard(replay.getConfig())), layout(initial), board(initial), openedAt(0) {
+    BoardGenerator().generate(initial, replay.getSeed());
+
+    // A no-guess board is generated with its opening cleared and its start cell revealed
+    int start = replay.header.startCell;
+    if (start >= 0) {
+        int width = initial.getWidth();
+        initial.clearOpening(start % width, start / width);
+        initial.setOpeningPending(false);
+        initial.reveal(start % width, start / width);
+    }
+
+    // The first reveal moves the mines out of its opening; after that the layout never changes
+    board = initial;
+    while (board.isOpeningPending() && step()) {}
+    openedAt = board.isOpeningPending() ? UINT32_MAX : cursor.move;
+    layout = board;
+    for (int cell: layout.touchedCells) {
+        layout.cells[cell] &= static_cast<std::uint8_t>(~(Board::REVEALED_BIT | Board::MARK_MASK));
+    }
+    layout.touchedCells.clear();
+    layout.revealedSafeCells = 0;
+    layout.explodedIndex = -1;
+
+    board = initial;
+    cursor = {};
+}
+
+/**
+ * @function ~ReplayEngine
+ * @brief Destructor for ReplayEngine.
+ *
+ * The replay is not owned by the engine.
+ */
+ReplayEngine::~ReplayEngine() = default;
+
+/**
+ * @function getBoard
+ * @brief Returns the board as it is after the moves played so far.
+ *
+ * @return The board.
+ */
+const Board &ReplayEngine::getBoard() const {
+    return board;
+}
+
+/**
+ * @function getPosition
+ * @brief Returns the number of moves played so far.
+ *
+ * @return The index of the next move.
+ */
+int ReplayEngine::getPosition() const {
+    return static_cast<int>(cursor.move);
+}
+
+/**
+ * @function step
+ * @brief Plays the next move.
+ *
+ * @return True if a move was played, false if the replay is at its end.
+ */
+bool ReplayEngine::step() {
+    if (static_cast<int>(cursor.move) >= replay.getMoveCount()) {
+        return false;
+    }
+
+    apply(replay.read(cursor));
+    return true;
+}
+
+/**
+ * @function seek
+ * @brief Brings the board to its state after the given number of moves.
+ *
+ * The last checkpoint before the target is found with a binary search. Moving forward past
+ * checkpoints writes the cells they changed over the current board, which then holds the state of
+ * the last one; moving back, or past the first reveal, does the same from the untouched board.
+ * From there at most CHECKPOINT_INTERVAL moves are played.
+ *
+ * @param move The number of moves, clamped to [0, the move count of the replay].
+ */
+void ReplayEngine::seek(int move) {
+    TRACE_SCOPE("ReplayEngine::seek");
+    auto target = static_cast<std::uint32_t>(std::clamp(move, 0, replay.getMoveCount()));
+
+    const std::vector<Replay::Checkpoint> &checkpoints = replay.checkpoints;
+    auto byMove = [](const Replay::Checkpoint &checkpoint, std::uint32_t move) {
+        return checkpoint.cursor.move < move;
+    };
+    auto last = std::lower_bound(checkpoints.begin(), checkpoints.end(), target + 1, byMove);
+
+    if (cursor.move > target) {
+        board = initial;
+        cursor = {};
+    }
+    if (last != checkpoints.begin() && std::prev(last)->cursor.move > cursor.move) {
+        // Every cell the moves since the current position changed is listed by the next checkpoint
+        auto first = std::lower_bound(checkpoints.begin(), last, cursor.move + 1, byMove);
+        if (cursor.move < openedAt && std::prev(last)->cursor.move >= openedAt) {
+            board = layout;
+            first = checkpoints.begin();
+        }
+        for (auto checkpoint = first; checkpoint != last; ++checkpoint) {
+            applyChanges(*checkpoint);
+        }
+        cursor = std::prev(last)->cursor;
+    }
+
+    while (cursor.move < target) {
+        step();
+    }
+}
+
+/**
+ * @function verify
+ * @brief Plays the whole replay and checks that it leads to the recorded states.
+ *
+ * Leaves the engine at the end of the replay.
+ *
+ * @return True if the board generated from the seed is the one the game was played on, every cell
+ *         a checkpoint lists is in the state it records, and the game ends as it was recorded.
+ */
+bool ReplayEngine::verify() {
+    TRACE_SCOPE("ReplayEngine::verify");
+    if (Replay::hashLayout(initial) != replay.header.layoutHash) {
+        return false;
+    }
+
+    board = initial;
+    cursor = {};
+
+    for (const Replay::Checkpoint &checkpoint: replay.checkpoints) {
+        while (cursor.move < checkpoint.cursor.move) {
+            step();
+        }
+        replay.readState(checkpoint, state);
+        for (std::uint32_t entry: state) {
+            if (Replay::getCellState(board, static_cast<int>(entry >> 2)) != (entry & 3)) {
+                return false;
+            }
+        }
+    }
+
+    while (step()) {}
+    return board.isWon() == replay.isWon() && board.isLost() == replay.isLost();
+}
+
+/**
+ * @function apply
+ * @brief Applies a move to the board by the rules the game and the bots play by.
+ *
+ * @param move The move.
+ */
+void ReplayEngine::apply(const Replay::Move &move) {
+    int width = board.getWidth();
+    int x = move.cell % width;
+    int y = move.cell / width;
+
+    switch (move.type) {
+        case Replay::MoveType::REVEAL:
+            Action::apply(board, {Action::Type::REVEAL, x, y}, changedCells);
+            break;
+        case Replay::MoveType::CHORD:
+            Action::apply(board, {Action::Type::CHORD, x, y}, changedCells);
+            break;
+        case Replay::MoveType::FLAG:
+            Action::apply(board, {Action::Type::FLAG, x, y}, changedCells);
+            break;
+        case Replay::MoveType::CYCLE_MARK:
+            if (!board.isLost() && !board.isWon()) {
+                board.cycleMark(x, y);
+            }
+            break;
+    }
+}
+
+/**
+ * @function applyChanges
+ * @brief Writes the cells a checkpoint lists into the board.
+ *
+ * Applied to the board at the previous checkpoint, or anywhere between it and this one, this
+ * leaves the board in the state of this checkpoint.
+ *
+ * @param checkpoint The checkpoint.
+ */
+void ReplayEngine::applyChanges(const Replay::Checkpoint &checkpoint) {
+    replay.readState(checkpoint, state);
+
+    for (std::uint32_t entry: state) {
+        auto cell = static_cast<int>(entry >> 2);
+        std::uint8_t &bits = board.cells[cell];
+        auto mark = Board::Mark::NONE;
+
+        switch (entry & 3) {
+            case Replay::REVEALED:
+                if (!(bits & Board::REVEALED_BIT)) {
+                    bits |= Board::REVEALED_BIT;
+                    if (bits & Board::MINE_BIT) {
+                        board.explodedIndex = cell;
+                    } else {
+                        board.revealedSafeCells++;
+                    }
+                }
+                break;
+            case Replay::FLAGGED:
+                mark = Board::Mark::FLAGGED;
+                break;
+            case Replay::QUESTIONED:
+                mark = Board::Mark::QUESTIONED;
+                break;
+            default:
+                break;
+        }
+        bits = static_cast<std::uint8_t>((bits & ~Board::MARK_MASK) | static_cast<int>(mark) << Board::MARK_SHIFT);
+        board.touchedCells.push_back(cell);
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * @file replayengine.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the ReplayEngine class, which plays a Replay back on a Board without any user
+ *        interface.
+ *
+ * The engine generates the board again from the seed of the replay and applies the moves with the
+ * same Board calls the game and the bots use, so playing a replay back is as fast as the board
+ * rules themselves. Seeking finds the last checkpoint before the target with a binary search and
+ * brings the board to it by writing the changed cells the checkpoints store, without replaying a
+ * move, then plays at most CHECKPOINT_INTERVAL moves from there. Seeking forward only writes the
+ * changes of the checkpoints passed; seeking back starts again from the untouched board. verify()
+ * plays a replay from start to end and checks the board against every checkpoint and the recorded
+ * result, which is how stored replays are validated after the engine changes.
+ */
+
+#ifndef QT_MINESWEEPER_REPLAYENGINE_H
+#define QT_MINESWEEPER_REPLAYENGINE_H
+
+#include <cstdint>
+#include <vector>
+#include "board.h"
+#include "replay.h"
+
+class ReplayEngine {
+public:
+
+    explicit ReplayEngine(const Replay &replay);
+
+    ~ReplayEngine();
+
+    ReplayEngine(const ReplayEngine &) = delete;
+
+    ReplayEngine &operator=(const ReplayEngine &) = delete;
+
+    const Board &getBoard() const;
+
+    int getPosition() const;
+
+    bool step();
+
+    void seek(int move);
+
+    bool verify();
+
+private:
+
+    void apply(const Replay::Move &move);
+
+    void applyChanges(const Replay::Checkpoint &checkpoint);
+
+    const Replay &replay;
+    Board initial; // The board before the first move
+    Board layout; // The layout once the first reveal has cleared its opening, with no cell touched
+    Board board;
+    std::uint32_t openedAt; // Moves after which the layout is final, UINT32_MAX if that never happens
+    Replay::Cursor cursor; // Before the next move to apply
+    std::vector<int> changedCells; // Reused across moves
+    std::vector<std::uint32_t> state; // Reused across checkpoints
+};
+
+#endif //QT_MINESWEEPER_REPLAYENGINE_H
@@ -0,0 +1,270 @@
+/**
+ * @file simulator.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Entry point of the headless Minesweeper simulator.
+ *
+ * Plays a number of games with one or more strategies on all cores and prints, for each strategy,
+ * the win rate, the distribution of moves per game and the time taken per decision as CSV or JSON.
+ * All strategies play the same boards, and the boards of lost games can be archived as snapshots
+ * with --archive. Every game can be saved as a replay with --replays, and --verify plays a
+ * directory of replays back and checks them. It only depends on Qt Core, for the command-line
+ * parsing and the JSON output, so it runs on machines without a display.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+#include "boardconfig.h"
+#include "gamesimulator.h"
+#include "replay.h"
+#include "replayengine.h"
+#include "strategy.h"
+#include "threadpool.h"
+
+namespace {
+
+/**
+ * @function verifyReplays
+ * @brief Plays back every replay in a directory and prints how many are valid.
+ *
+ * @param directory The directory; every .msrep file in it is checked.
+ * @param format The output format, csv or json.
+ * @return The exit code: 0 if every replay is valid, 1 otherwise.
+ */
+int verifyReplays(const std::string &directory, const QString &format) {
+    std::error_code error;
+    std::vector<std::filesystem::path> paths;
+    for (const auto &entry: std::filesystem::directory_iterator(directory, error)) {
+        if (entry.path().extension() == ".msrep") {
+            paths.push_back(entry.path());
+        }
+    }
+    if (error) {
+        qCritical() << "Cannot read the replay directory " << QString::fromStdString(directory);
+        return 1;
+    }
+    std::sort(paths.begin(), paths.end());
+
+    long long invalid = 0;
+    long long moves = 0;
+    double seconds = 0;
+    for (const std::filesystem::path &path: paths) {
+        std::optional<Replay> replay = Replay::load(path.string());
+        auto start = std::chrono::steady_clock::now();
+        bool valid = replay && ReplayEngine(*replay).verify();
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (!valid) {
+            qWarning() << "Invalid replay: " << QString::fromStdString(path.string());
+            invalid++;
+        } else {
+            moves += replay->getMoveCount();
+        }
+    }
+
+    double movesPerSecond = seconds > 0 ? static_cast<double>(moves) / seconds : 0;
+    QTextStream out(stdout);
+    if (format == "json") {
+        out << QJsonDocument(QJsonObject{
+                {"replays",        static_cast<qint64>(paths.size())},
+                {"invalid",        invalid},
+                {"moves",          moves},
+                {"seconds",        seconds},
+                {"movesPerSecond", movesPerSecond}
+        }).toJson();
+    } else {
+        out << "replays,invalid,moves,seconds,moves_per_second\n"
+            << paths.size() << ',' << invalid << ',' << moves << ',' << seconds << ',' << movesPerSecond << '\n';
+    }
+    return invalid == 0 ? 0 : 1;
+}
+
+}
+
+/**
+ * @function main
+ * @brief Entry point of the Minesweeper simulator.
+ *
+ * @param argc The number of command-line arguments.
+ * @param argv The command-line arguments.
+ * @return The exit code of the simulator.
+ */
+int main(int argc, char *argv[]) {
+    QCoreApplication application(argc, argv);
+    QCoreApplication::setApplicationName("Minesweeper Simulator");
+    QCoreApplication::setApplicationVersion("1.0.0");
+
+    BoardConfig config = BoardConfig::expert();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Plays Minesweeper games without a user interface and reports statistics.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    QCommandLineOption widthOption("width", "Number of tiles in a row.", "tiles", QString::number(config.width));
+    QCommandLineOption heightOption("height", "Number of tiles in a column.", "tiles", QString::number(config.height));
+    QCommandLineOption minesOption("mines", "Number of mines.", "count", QString::number(config.mineCount));
+    QCommandLineOption topologyOption("topology", "Which tiles are neighbours: rectangle, torus or hex.", "name",
+                                      Topology::getName(config.topology));
+    QCommandLineOption gamesOption("games", "Number of games to play.", "count", "10000");
+    QCommandLineOption strategyOption("strategy", "Comma-separated strategies that play the same games: random, solver "
+                                      "or probability.", "names", "probability");
+    QCommandLineOption seedOption("seed", "Seed of the boards and guesses (random by default).", "seed");
+    QCommandLineOption threadsOption("threads", "Number of threads.", "count",
+                                     QString::number(ThreadPool::defaultThreadCount()));
+    QCommandLineOption noGuessOption("no-guess", "Play boards that can be solved without guessing.");
+    QCommandLineOption archiveOption("archive", "Save the final board of every lost game to the directory as a "
+                                     "snapshot.", "directory");
+    QCommandLineOption replaysOption("replays", "Save every game to the directory as a replay.", "directory");
+    QCommandLineOption verifyOption("verify", "Play back every replay in the directory, check it and exit.",
+                                    "directory");
+    QCommandLineOption formatOption("format", "Output format: csv or json.", "format", "csv");
+    parser.addOptions({widthOption, heightOption, minesOption, topologyOption, gamesOption, strategyOption,
+                       seedOption, threadsOption, noGuessOption, archiveOption, replaysOption, verifyOption,
+                       formatOption});
+    parser.process(application);
+
+    config.width = parser.value(widthOption).toInt();
+    config.height = parser.value(heightOption).toInt();
+    config.mineCount = parser.value(minesOption).toInt();
+    long long games = parser.value(gamesOption).toLongLong();
+    int threads = parser.value(threadsOption).toInt();
+    QString format = parser.value(formatOption);
+
+    if (parser.isSet(verifyOption)) {
+        return verifyReplays(parser.value(verifyOption).toStdString(), format);
+    }
+
+    if (!Topology::parse(parser.value(topologyOption).toStdString(), config.topology)) {
+        qCritical() << "Unknown topology: " << parser.value(topologyOption);
+        return 1;
+    }
+
+    if (!config.isValid()) {
+        qCritical() << "Invalid board configuration: " << config.width << "x" << config.height << ", "
+                    << config.mineCount << " mines";
+        return 1;
+    }
+
+    std::vector<std::string> strategies;
+    for (const QString &name: parser.value(strategyOption).split(',', Qt::SkipEmptyParts)) {
+        if (!Strategy::create(name.trimmed().toStdString())) {
+            qCritical() << "Unknown strategy: " << name;
+            return 1;
+        }
+        strategies.push_back(name.trimmed().toStdString());
+    }
+
+    if (strategies.empty() || games <= 0 || threads <= 0 || (format != "csv" && format != "json")) {
+        qCritical() << "Invalid strategy, games, threads or format option";
+        return 1;
+    }
+
+    std::string archive = parser.value(archiveOption).toStdString();
+    std::error_code error;
+    if (!archive.empty() && !std::filesystem::create_directories(archive, error) && error) {
+        qCritical() << "Cannot create the archive directory " << parser.value(archiveOption);
+        return 1;
+    }
+
+    std::string replays = parser.value(replaysOption).toStdString();
+    if (!replays.empty() && !std::filesystem::create_directories(replays, error) && error) {
+        qCritical() << "Cannot create the replay directory " << parser.value(replaysOption);
+        return 1;
+    }
+
+    std::uint64_t seed = parser.isSet(seedOption)
+                         ? parser.value(seedOption).toULongLong()
+                         : (static_cast<std::uint64_t>(std::random_device{}()) << 32) | std::random_device{}();
+
+    ThreadPool pool(threads);
+    GameSimulator simulator(&pool);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<GameSimulator::Statistics> results = simulator.run(config, strategies, games, seed,
+                                                                   parser.isSet(noGuessOption), archive, replays);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double gamesPerSecond = static_cast<double>(games * static_cast<long long>(strategies.size())) / seconds;
+
+    QTextStream out(stdout);
+
+    if (format == "json") {
+        QJsonArray reports;
+        for (std::size_t i = 0; i < strategies.size(); i++) {
+            const GameSimulator::Statistics &statistics = results[i];
+
+            QJsonArray moveCounts;
+            for (long long count: statistics.moveCounts) {
+                moveCounts.append(count);
+            }
+
+            QJsonObject moves{
+                    {"mean",      static_cast<double>(statistics.moves) / static_cast<double>(statistics.games)},
+                    {"p50",       statistics.getMovePercentile(50)},
+                    {"p90",       statistics.getMovePercentile(90)},
+                    {"p99",       statistics.getMovePercentile(99)},
+                    {"max",       static_cast<int>(statistics.moveCounts.size()) - 1},
+                    {"histogram", moveCounts}
+            };
+            QJsonObject latency{
+                    {"p50", statistics.getLatencyPercentile(50)},
+                    {"p90", statistics.getLatencyPercentile(90)},
+                    {"p99", statistics.getLatencyPercentile(99)},
+                    {"max", statistics.getLatencyPercentile(100)}
+            };
+            reports.append(QJsonObject{
+                    {"strategy",  QString::fromStdString(strategies[i])},
+                    {"games",     statistics.games},
+                    {"wins",      statistics.wins},
+                    {"winRate",   static_cast<double>(statistics.wins) / static_cast<double>(statistics.games)},
+                    {"moves",     moves},
+                    {"latencyNs", latency}
+            });
+        }
+
+        QJsonObject report{
+                {"width",          config.width},
+                {"height",         config.height},
+                {"mines",          config.mineCount},
+                {"topology",       Topology::getName(config.topology)},
+                {"noGuess",        parser.isSet(noGuessOption)},
+                {"seed",           QString::number(seed)},
+                {"threads",        threads},
+                {"seconds",        seconds},
+                {"gamesPerSecond", gamesPerSecond},
+                {"strategies",     reports}
+        };
+        out << QJsonDocument(report).toJson();
+    } else {
+        out << "strategy,width,height,mines,topology,no_guess,seed,threads,games,wins,win_rate,seconds,"
+               "games_per_second,moves_mean,moves_p50,moves_p90,moves_p99,moves_max,latency_ns_p50,"
+               "latency_ns_p90,latency_ns_p99,latency_ns_max\n";
+        for (std::size_t i = 0; i < strategies.size(); i++) {
+            const GameSimulator::Statistics &statistics = results[i];
+            double winRate = static_cast<double>(statistics.wins) / static_cast<double>(statistics.games);
+            double meanMoves = static_cast<double>(statistics.moves) / static_cast<double>(statistics.games);
+
+            out << QString::fromStdString(strategies[i]) << ',' << config.width << ',' << config.height << ','
+                << config.mineCount << ',' << Topology::getName(config.topology) << ','
+                << (parser.isSet(noGuessOption) ? 1 : 0) << ',' << seed << ','
+                << threads << ',' << statistics.games << ',' << statistics.wins << ',' << winRate << ','
+                << seconds << ',' << gamesPerSecond << ',' << meanMoves << ','
+                << statistics.getMovePercentile(50) << ',' << statistics.getMovePercentile(90) << ','
+                << statistics.getMovePercentile(99) << ',' << statistics.moveCounts.size() - 1 << ','
+                << statistics.getLatencyPercentile(50) << ',' << statistics.getLatencyPercentile(90) << ','
+                << statistics.getLatencyPercentile(99) << ',' << statistics.getLatencyPercentile(100) << '\n';
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,465 @@
+/**
+ * @file snapshot.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the Snapshot class, which writes boards as bit-planes and maps them back
+ *        into memory to read them in place.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include <vector>
+#include "boardconfig.h"
+#include "random.h"
+#include "snapshot.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// The planes are read in place, so the file layout has to be the in-memory layout
+static_assert(std::endian::native == std::endian::little, "Snapshots are only supported on little-endian platforms");
+
+/**
+ * @function save
+ * @brief Writes the complete state of a board to a file.
+ *
+ * An existing file is overwritten.
+ *
+ * @param board The board to save.
+ * @param path The path of the file.
+ * @return True if the file was written, false if it could not be.
+ */
+bool Snapshot::save(const Board &board, const std::string &path) {
+    static_assert(sizeof(Header) == 64 && std::is_trivially_copyable_v<Header>);
+
+    int width = board.getWidth();
+    int height = board.getHeight();
+    int wordsPerRow = board.getWordsPerRow();
+    auto wordsPerPlane = static_cast<std::size_t>(wordsPerRow) * height;
+
+    std::vector<std::uint64_t> planeWords(PLANE_COUNT * wordsPerPlane, 0);
+    std::copy_n(board.getMinePlane(), wordsPerPlane, planeWords.begin() + MINES * wordsPerPlane);
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            std::uint8_t cell = board.cells[board.index(x, y)];
+            std::size_t word = static_cast<std::size_t>(y) * wordsPerRow + x / 64;
+            std::uint64_t bit = 1ULL << (x % 64);
+
+            if (cell & Board::REVEALED_BIT || board.allRevealed) {
+                planeWords[REVEALED * wordsPerPlane + word] |= bit;
+            }
+            auto mark = static_cast<Board::Mark>(cell >> Board::MARK_SHIFT);
+            if (mark == Board::Mark::FLAGGED) {
+                planeWords[FLAGGED * wordsPerPlane + word] |= bit;
+            } else if (mark == Board::Mark::QUESTIONED) {
+                planeWords[QUESTIONED * wordsPerPlane + word] |= bit;
+            }
+        }
+    }
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof MAGIC);
+    header.version = VERSION;
+    header.headerSize = sizeof(Header);
+    header.width = static_cast<std::uint32_t>(width);
+    header.height = static_cast<std::uint32_t>(height);
+    header.mineCount = static_cast<std::uint32_t>(board.getMineCount());
+    header.topology = static_cast<std::uint8_t>(board.getTopology());
+    header.flags = board.isOpeningPending() ? FLAG_OPENING_PENDING : 0;
+    header.seed = board.getSeed();
+    header.revealedSafeCells = board.getRevealedSafeCells();
+    header.explodedIndex = board.explodedIndex;
+    header.wordsPerPlane = wordsPerPlane;
+    header.checksum = checksum(header, planeWords.data());
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&header), sizeof header);
+    out.write(reinterpret_cast<const char *>(planeWords.data()),
+              static_cast<std::streamsize>(planeWords.size() * sizeof(std::uint64_t)));
+    out.close();
+    return !out.fail();
+}
+
+/**
+ * @function open
+ * @brief Maps a snapshot file into memory.
+ *
+ * The file is checked completely, including its checksum, before it is returned, so the accessors
+ * never read out of bounds. The file stays mapped until the snapshot is destroyed.
+ *
+ * @param path The path of the file.
+ * @return The snapshot, or nullptr if the file cannot be read, is not a snapshot of this version or
+ *         is corrupt.
+ */
+std::unique_ptr<Snapshot> Snapshot::open(const std::string &path) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(Header))) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        return nullptr;
+    }
+
+    const void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        CloseHandle(mapping);
+        return nullptr;
+    }
+    std::unique_ptr<Snapshot> snapshot(new Snapshot(data, static_cast<std::size_t>(fileSize.QuadPart), mapping));
+#else
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        return nullptr;
+    }
+
+    struct stat status{};
+    if (fstat(file, &status) != 0 || status.st_size < static_cast<off_t>(sizeof(Header))) {
+        close(file);
+        return nullptr;
+    }
+
+    auto fileSize = static_cast<std::size_t>(status.st_size);
+    void *data = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    std::unique_ptr<Snapshot> snapshot(new Snapshot(data, fileSize, nullptr));
+#endif
+
+    if (!snapshot->isValid()) {
+        return nullptr;
+    }
+    return snapshot;
+}
+
+/**
+ * @function Snapshot
+ * @brief Wraps a mapped file.
+ *
+ * @param data The start of the mapped file, at least as large as the header.
+ * @param size The size of the file in bytes.
+ * @param mapping The handle of the file mapping, or nullptr on platforms without one.
+ */
+Snapshot::Snapshot(const void *data, std::size_t size, void *mapping)
+        : header(static_cast<const Header *>(data)),
+          planes(reinterpret_cast<const std::uint64_t *>(static_cast<const char *>(data) + sizeof(Header))),
+          size(size), mapping(mapping), wordsPerRow(static_cast<int>((header->width + 63ULL) / 64)) {}
+
+/**
+ * @function ~Snapshot
+ * @brief Unmaps the file.
+ */
+Snapshot::~Snapshot() {
+#ifdef _WIN32
+    UnmapViewOfFile(header);
+    CloseHandle(mapping);
+#else
+    munmap(const_cast<Header *>(header), size);
+#endif
+}
+
+/**
+ * @function getWidth
+ * @brief Returns the number of cells in a row.
+ *
+ * @return The width of the board.
+ */
+int Snapshot::getWidth() const {
+    return static_cast<int>(header->width);
+}
+
+/**
+ * @function getHeight
+ * @brief Returns the number of cells in a column.
+ *
+ * @return The height of the board.
+ */
+int Snapshot::getHeight() const {
+    return static_cast<int>(header->height);
+}
+
+/**
+ * @function getMineCount
+ * @brief Returns the number of mines on the board.
+ *
+ * @return The mine count.
+ */
+int Snapshot::getMineCount() const {
+    return static_cast<int>(header->mineCount);
+}
+
+/**
+ * @function getTopology
+ * @brief Returns which cells of the board are neighbours.
+ *
+ * @return The topology of the board.
+ */
+Topology::Kind Snapshot::getTopology() const {
+    return static_cast<Topology::Kind>(header->topology);
+}
+
+/**
+ * @function getSeed
+ * @brief Returns the seed the mine layout was generated from.
+ *
+ * @return The seed.
+ */
+std::uint64_t Snapshot::getSeed() const {
+    return header->seed;
+}
+
+/**
+ * @function getRevealedSafeCells
+ * @brief Returns the number of safe cells the player had revealed.
+ *
+ * @return The number of revealed safe cells.
+ */
+int Snapshot::getRevealedSafeCells() const {
+    return header->revealedSafeCells;
+}
+
+/**
+ * @function isLost
+ * @brief Returns true if a mine had been revealed.
+ *
+ * @return True if the game was lost.
+ */
+bool Snapshot::isLost() const {
+    return header->explodedIndex >= 0;
+}
+
+/**
+ * @function isMine
+ * @brief Returns true if the cell holds a mine.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return True if the cell is a mine.
+ */
+bool Snapshot::isMine(int x, int y) const {
+    return getBit(MINES, x, y);
+}
+
+/**
+ * @function isRevealed
+ * @brief Returns true if the cell had been revealed.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return True if the cell is revealed.
+ */
+bool Snapshot::isRevealed(int x, int y) const {
+    return getBit(REVEALED, x, y);
+}
+
+/**
+ * @function getMark
+ * @brief Returns the mark the player had put on the cell.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The mark of the cell.
+ */
+Board::Mark Snapshot::getMark(int x, int y) const {
+    if (getBit(FLAGGED, x, y)) {
+        return Board::Mark::FLAGGED;
+    }
+    return getBit(QUESTIONED, x, y) ? Board::Mark::QUESTIONED : Board::Mark::NONE;
+}
+
+/**
+ * @function getMinePlane
+ * @brief Returns the mines as a bit-plane, read in place from the file.
+ *
+ * @return The plane, in the layout of Board::getMinePlane().
+ */
+const std::uint64_t *Snapshot::getMinePlane() const {
+    return planes + MINES * header->wordsPerPlane;
+}
+
+/**
+ * @function toBoard
+ * @brief Builds a board in the exact state that was saved, ready to be played on.
+ *
+ * The adjacent counts are not stored, so they are calculated again.
+ *
+ * @return The board.
+ */
+Board Snapshot::toBoard() const {
+    int width = getWidth();
+    int height = getHeight();
+    std::size_t wordsPerPlane = header->wordsPerPlane;
+    Board board(width, height, getMineCount(), getTopology());
+
+    std::copy_n(getMinePlane(), wordsPerPlane, board.minePlane.begin());
+
+    // The plane bits land directly on the bits of the packed cell byte
+    static_assert(Board::MINE_BIT == 1 << 4 && Board::REVEALED_BIT == 1 << 5 && Board::MARK_SHIFT == 6 &&
+                  static_cast<int>(Board::Mark::FLAGGED) == 1 && static_cast<int>(Board::Mark::QUESTIONED) == 2);
+    for (int y = 0; y < height; y++) {
+        for (int w = 0; w < wordsPerRow; w++) {
+            std::size_t word = static_cast<std::size_t>(y) * wordsPerRow + w;
+            std::uint64_t mines = planes[MINES * wordsPerPlane + word];
+            std::uint64_t revealed = planes[REVEALED * wordsPerPlane + word];
+            std::uint64_t flagged = planes[FLAGGED * wordsPerPlane + word];
+            std::uint64_t questioned = planes[QUESTIONED * wordsPerPlane + word] & ~flagged;
+
+            std::uint8_t *cells = &board.cells[static_cast<std::size_t>(y) * width + w * 64];
+            int bits = std::min(64, width - w * 64);
+            for (int bit = 0; bit < bits; bit++) {
+                cells[bit] = static_cast<std::uint8_t>(((mines >> bit) & 1) << 4 | ((revealed >> bit) & 1) << 5 |
+                                                       ((flagged >> bit) & 1) << 6 | ((questioned >> bit) & 1) << 7);
+            }
+            std::uint64_t touched = (revealed | flagged | questioned) & (~0ULL >> (64 - bits));
+            for (; touched; touched &= touched - 1) {
+                board.touchedCells.push_back(y * width + w * 64 + std::countr_zero(touched));
+            }
+        }
+    }
+    board.calculateAdjacentMines();
+
+    board.seed = header->seed;
+    board.revealedSafeCells = header->revealedSafeCells;
+    board.explodedIndex = header->explodedIndex;
+    board.openingPending = (header->flags & FLAG_OPENING_PENDING) != 0;
+    return board;
+}
+
+/**
+ * @function isValid
+ * @brief Checks that the mapped file is a complete, uncorrupted snapshot of this version.
+ *
+ * Besides the header and the checksum, the bits past the last column of every row must be clear and
+ * the planes must match the counts of the header: as many mines as it says, and in a game that is
+ * not lost, exactly its revealed safe cells and no revealed mine. The exploded cell of a lost game
+ * must be a revealed mine.
+ *
+ * @return True if the file can be read safely.
+ */
+bool Snapshot::isValid() const {
+    if (std::memcmp(header->magic, MAGIC, sizeof MAGIC) != 0 || header->version != VERSION ||
+        header->headerSize != sizeof(Header)) {
+        return false;
+    }
+
+    long long cellCount = static_cast<long long>(header->width) * header->height;
+    if (header->width == 0 || header->height == 0 || cellCount > BoardConfig::MAX_CELLS ||
+        header->mineCount > cellCount || header->topology > static_cast<std::uint8_t>(Topology::Kind::HEX)) {
+        return false;
+    }
+
+    std::uint64_t wordsPerPlane = static_cast<std::uint64_t>(wordsPerRow) * header->height;
+    if (header->wordsPerPlane != wordsPerPlane ||
+        size != sizeof(Header) + PLANE_COUNT * wordsPerPlane * sizeof(std::uint64_t)) {
+        return false;
+    }
+
+    if (header->explodedIndex < -1 || header->explodedIndex >= cellCount || header->revealedSafeCells < 0 ||
+        header->revealedSafeCells > cellCount - header->mineCount) {
+        return false;
+    }
+
+    if (checksum(*header, planes) != header->checksum) {
+        return false;
+    }
+
+    // A file written by another program can have a valid checksum and still disagree with itself
+    int lastBits = static_cast<int>(header->width % 64);
+    std::uint64_t padding = lastBits ? ~0ULL << lastBits : 0;
+    for (std::uint64_t plane = 0; plane < PLANE_COUNT; plane++) {
+        for (std::uint64_t row = 1; row <= header->height; row++) {
+            if (planes[plane * wordsPerPlane + row * wordsPerRow - 1] & padding) {
+                return false;
+            }
+        }
+    }
+
+    long long mines = 0;
+    long long revealedSafeCells = 0;
+    bool revealedMine = false;
+    for (std::uint64_t word = 0; word < wordsPerPlane; word++) {
+        std::uint64_t mineWord = planes[MINES * wordsPerPlane + word];
+        std::uint64_t revealedWord = planes[REVEALED * wordsPerPlane + word];
+        mines += std::popcount(mineWord);
+        revealedSafeCells += std::popcount(revealedWord & ~mineWord);
+        revealedMine |= (revealedWord & mineWord) != 0;
+    }
+    if (mines != header->mineCount) {
+        return false;
+    }
+
+    if (header->explodedIndex == -1) {
+        return !revealedMine && revealedSafeCells == header->revealedSafeCells;
+    }
+
+    // A lost board can have been shown completely, which does not count towards its revealed safe cells
+    int x = static_cast<int>(header->explodedIndex % header->width);
+    int y = static_cast<int>(header->explodedIndex / header->width);
+    return getBit(MINES, x, y) && getBit(REVEALED, x, y) && revealedSafeCells >= header->revealedSafeCells;
+}
+
+/**
+ * @function getBit
+ * @brief Reads the bit of a cell from one of the planes.
+ *
+ * @param plane The plane.
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The bit.
+ */
+bool Snapshot::getBit(Plane plane, int x, int y) const {
+    std::size_t word = plane * header->wordsPerPlane + static_cast<std::size_t>(y) * wordsPerRow + x / 64;
+    return (planes[word] >> (x % 64)) & 1;
+}
+
+/**
+ * @function checksum
+ * @brief Hashes a header, with its checksum field taken as zero, and the planes that follow it.
+ *
+ * Each 64-bit word is folded in with the SplitMix64 finaliser, which is fast enough to check a
+ * board of hundreds of millions of cells in well under a second.
+ *
+ * @param header The header, which gives the size of the planes.
+ * @param planes The planes.
+ * @return The checksum.
+ */
+std::uint64_t Snapshot::checksum(const Header &header, const std::uint64_t *planes) {
+    Header unsummed = header;
+    unsummed.checksum = 0;
+    std::uint64_t headerWords[sizeof(Header) / sizeof(std::uint64_t)];
+    std::memcpy(headerWords, &unsummed, sizeof(Header));
+
+    std::uint64_t hash = 0;
+    for (std::uint64_t word: headerWords) {
+        hash = Random::mix(hash ^ word);
+    }
+    for (std::uint64_t i = 0; i < PLANE_COUNT * header.wordsPerPlane; i++) {
+        hash = Random::mix(hash ^ planes[i]);
+    }
+    return hash;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file snapshot.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the Snapshot class, a compact binary file that holds the complete state of a Board.
+ *
+ * A snapshot starts with a 64-byte header (magic, format version, dimensions, topology, seed,
+ * counters and a checksum), followed by four bit-planes: mines, revealed cells, flags and question
+ * marks. Every plane has one bit per cell in the layout of Board::getMinePlane(), rows padded to
+ * whole 64-bit words, so a board costs half a byte per cell on disk. All fields are little-endian
+ * and 8-byte aligned, so open() memory-maps the file and every accessor reads it in place; nothing
+ * is copied until toBoard() builds a playable board from it. The checksum covers the header and
+ * all planes, and is checked when the file is opened.
+ */
+
+#ifndef QT_MINESWEEPER_SNAPSHOT_H
+#define QT_MINESWEEPER_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "board.h"
+
+class Snapshot {
+public:
+
+    static constexpr std::uint32_t VERSION = 1;
+
+    static bool save(const Board &board, const std::string &path);
+
+    static std::unique_ptr<Snapshot> open(const std::string &path);
+
+    ~Snapshot();
+
+    Snapshot(const Snapshot &) = delete;
+
+    Snapshot &operator=(const Snapshot &) = delete;
+
+    int getWidth() const;
+
+    int getHeight() const;
+
+    int getMineCount() const;
+
+    Topology::Kind getTopology() const;
+
+    std::uint64_t getSeed() const;
+
+    int getRevealedSafeCells() const;
+
+    bool isLost() const;
+
+    bool isMine(int x, int y) const;
+
+    bool isRevealed(int x, int y) const;
+
+    Board::Mark getMark(int x, int y) const;
+
+    const std::uint64_t *getMinePlane() const;
+
+    Board toBoard() const;
+
+private:
+
+    enum Plane {
+        MINES,
+        REVEALED,
+        FLAGGED,
+        QUESTIONED,
+        PLANE_COUNT
+    };
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t headerSize;
+        std::uint32_t width;
+        std::uint32_t height;
+        std::uint32_t mineCount;
+        std::uint8_t topology;
+        std::uint8_t flags; // FLAG_OPENING_PENDING
+        std::uint16_t reserved;
+        std::uint64_t seed;
+        std::int32_t revealedSafeCells;
+        std::int32_t explodedIndex; // -1 while no mine has been stepped on
+        std::uint64_t wordsPerPlane;
+        std::uint64_t checksum; // Of the header with this field zero, then of the planes
+    };
+
+    static constexpr char MAGIC[8] = {'M', 'S', 'W', 'P', 'S', 'N', 'A', 'P'};
+    static constexpr std::uint8_t FLAG_OPENING_PENDING = 0x01;
+
+    Snapshot(const void *data, std::size_t size, void *mapping);
+
+    bool isValid() const;
+
+    bool getBit(Plane plane, int x, int y) const;
+
+    static std::uint64_t checksum(const Header &header, const std::uint64_t *planes);
+
+    const Header *header;
+    const std::uint64_t *planes; // PLANE_COUNT planes of header->wordsPerPlane words
+    std::size_t size; // Bytes mapped
+    void *mapping; // Handle of the file mapping where the platform has one
+    int wordsPerRow;
+};
+
+#endif //QT_MINESWEEPER_SNAPSHOT_H
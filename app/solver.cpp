@@ -0,0 +1,422 @@
+/**
+ * @file solver.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the Solver class, which propagates the constraints of the revealed cells
+ *        incrementally to find safe cells and mines.
+ */
+
+#include <algorithm>
+#include <bit>
+#include "solver.h"
+#include "trace.h"
+
+/**
+ * @function Solver
+ * @brief Constructs a Solver for a board and reads its current state.
+ *
+ * @param view The view of the board to solve. The board must outlive the solver.
+ */
+Solver::Solver(PlayerView view) : view(view), width(0), height(0) {
+    reset();
+}
+
+/**
+ * @function ~Solver
+ * @brief Destructor for Solver.
+ *
+ * The board is not owned by the solver.
+ */
+Solver::~Solver() = default;
+
+/**
+ * @function reset
+ * @brief Forgets every deduction and rebuilds the constraints from the board.
+ *
+ * Call it when a new game starts or the board is replaced; after that, update() keeps the solver in
+ * sync one move at a time. If the board has as many cells as before, only the cells the solver
+ * touched are cleared, and the revealed cells are taken from the touched list of the board, so the
+ * cost depends on how far the games got rather than on the size of the board.
+ */
+void Solver::reset() {
+    TRACE_SCOPE("Solver::reset");
+    width = view.getWidth();
+    height = view.getHeight();
+    topology = Topology::get(view.getTopology(), width, height);
+    auto cellCount = static_cast<std::size_t>(width) * height;
+
+    if (states.size() == cellCount) {
+        for (int cell: touchedCells) {
+            masks[cell] = 0;
+            remaining[cell] = 0;
+            states[cell] = UNKNOWN;
+            queued[cell] = 0;
+        }
+    } else {
+        masks.assign(cellCount, 0);
+        remaining.assign(cellCount, 0);
+        states.assign(cellCount, UNKNOWN);
+        queued.assign(cellCount, 0);
+    }
+    touchedCells.clear();
+    dirty.clear();
+    safeCells.clear();
+    knownMines.clear();
+
+    // Once the whole board is shown after a loss, the revealed cells are no longer all touched
+    std::vector<int> revealedCells;
+    if (view.isLost()) {
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                if (view.getAdjacentMines(x, y) >= 0) {
+                    revealedCells.push_back(y * width + x);
+                }
+            }
+        }
+    } else {
+        for (int cell: view.getTouchedCells()) {
+            if (view.getAdjacentMines(cell % width, cell / width) >= 0) {
+                revealedCells.push_back(cell);
+            }
+        }
+    }
+    update(revealedCells);
+}
+
+/**
+ * @function update
+ * @brief Adds newly revealed cells and propagates the constraints until nothing more follows.
+ *
+ * Only the constraints around the new cells, and around the cells deduced from them, are checked.
+ *
+ * @param revealedCells The board indices of the cells revealed since the last update.
+ */
+void Solver::update(std::span<const int> revealedCells) {
+    TRACE_SCOPE("Solver::update");
+    for (int cell: revealedCells) {
+        addRevealed(cell);
+    }
+    propagate();
+}
+
+/**
+ * @function isKnownSafe
+ * @brief Returns true if the cell is revealed or certainly has no mine.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return True if the cell is known to be safe.
+ */
+bool Solver::isKnownSafe(int x, int y) const {
+    State state = states[y * width + x];
+    return state == SAFE || state == REVEALED;
+}
+
+/**
+ * @function isKnownMine
+ * @brief Returns true if the cell certainly has a mine.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return True if the cell is known to be a mine.
+ */
+bool Solver::isKnownMine(int x, int y) const {
+    return states[y * width + x] == MINE;
+}
+
+/**
+ * @function findSafeCell
+ * @brief Returns a hidden cell that is certainly safe to reveal.
+ *
+ * Cells that were deduced safe but have been revealed since are dropped on the way.
+ *
+ * @return The board index of a safe hidden cell, or -1 if none can be deduced.
+ */
+int Solver::findSafeCell() {
+    while (!safeCells.empty()) {
+        int cell = safeCells.back();
+        if (states[cell] == SAFE) {
+            return cell;
+        }
+        safeCells.pop_back();
+    }
+    return -1;
+}
+
+/**
+ * @function getKnownMines
+ * @brief Returns every cell that has been deduced to be a mine, in the order they were found.
+ *
+ * @return The board indices of the known mines.
+ */
+const std::vector<int> &Solver::getKnownMines() const {
+    return knownMines;
+}
+
+/**
+ * @function addRevealed
+ * @brief Turns a newly revealed cell into a constraint.
+ *
+ * The cell is removed from the constraints around it, then its own constraint is built from its
+ * adjacent count and the state of its neighbours.
+ *
+ * @param cell The board index of the revealed cell.
+ */
+void Solver::addRevealed(int cell) {
+    if (states[cell] == REVEALED || states[cell] == MINE) {
+        return;
+    }
+
+    if (states[cell] == UNKNOWN) {
+        removeFromConstraints(cell, false);
+        touchedCells.push_back(cell);
+    }
+    states[cell] = REVEALED;
+
+    Topology::Neighbours neighbours = topology->getNeighbours(cell);
+    std::uint8_t mask = 0;
+    int mines = 0;
+
+    for (std::size_t slot = 0; slot < neighbours.size(); slot++) {
+        State state = states[neighbours[slot]];
+        if (state == UNKNOWN) {
+            mask |= 1 << slot;
+        } else if (state == MINE) {
+            mines++;
+        }
+    }
+
+    masks[cell] = mask;
+    remaining[cell] = static_cast<std::uint8_t>(view.getAdjacentMines(cell % width, cell / width) - mines);
+    if (mask) {
+        enqueue(cell);
+    }
+}
+
+/**
+ * @function markSafe
+ * @brief Records that a hidden cell certainly has no mine.
+ *
+ * @param cell The board index of the cell.
+ */
+void Solver::markSafe(int cell) {
+    if (states[cell] != UNKNOWN) {
+        return;
+    }
+
+    states[cell] = SAFE;
+    touchedCells.push_back(cell);
+    removeFromConstraints(cell, false);
+    safeCells.push_back(cell);
+}
+
+/**
+ * @function markMine
+ * @brief Records that a hidden cell certainly has a mine.
+ *
+ * @param cell The board index of the cell.
+ */
+void Solver::markMine(int cell) {
+    if (states[cell] != UNKNOWN) {
+        return;
+    }
+
+    states[cell] = MINE;
+    touchedCells.push_back(cell);
+    removeFromConstraints(cell, true);
+    knownMines.push_back(cell);
+}
+
+/**
+ * @function removeFromConstraints
+ * @brief Removes a cell that is no longer unknown from the constraints of its revealed neighbours.
+ *
+ * @param cell The board index of the cell.
+ * @param mine True if the cell is a mine, which also lowers the remaining count of each constraint.
+ */
+void Solver::removeFromConstraints(int cell, bool mine) {
+    Topology::Neighbours neighbours = topology->getNeighbours(cell);
+
+    for (std::size_t slot = 0; slot < neighbours.size(); slot++) {
+        int neighbour = neighbours[slot];
+        if (states[neighbour] != REVEALED) continue;
+
+        masks[neighbour] &= ~(1 << topology->getReverseSlot(neighbours, slot));
+        if (mine) {
+            remaining[neighbour]--;
+        }
+        enqueue(neighbour);
+    }
+}
+
+/**
+ * @function enqueue
+ * @brief Queues a constraint to be checked, unless it is already queued.
+ *
+ * @param cell The board index of the revealed cell.
+ */
+void Solver::enqueue(int cell) {
+    if (!queued[cell]) {
+        queued[cell] = 1;
+        dirty.push_back(cell);
+    }
+}
+
+/**
+ * @function propagate
+ * @brief Checks queued constraints until the queue is empty.
+ *
+ * Every deduction changes the constraints around the deduced cell, which queues them again, so
+ * when the queue runs dry no single constraint or pair of constraints allows another deduction.
+ */
+void Solver::propagate() {
+    while (!dirty.empty()) {
+        int cell = dirty.back();
+        dirty.pop_back();
+        queued[cell] = 0;
+        checkConstraint(cell);
+    }
+}
+
+/**
+ * @function checkConstraint
+ * @brief Looks for deductions from a constraint alone and together with each one it overlaps.
+ *
+ * Stops at the first deduction and queues the constraint again, since its own mask may have changed.
+ *
+ * @param cell The board index of the revealed cell.
+ */
+void Solver::checkConstraint(int cell) {
+    std::uint8_t mask = masks[cell];
+    if (!mask) {
+        return;
+    }
+
+    int mines = remaining[cell];
+    int unknown = std::popcount(mask);
+    Topology::Neighbours neighbours = topology->getNeighbours(cell);
+
+    if (mines == 0 || mines == unknown) {
+        markCells(mask, neighbours, neighbours, mines != 0);
+        return;
+    }
+
+    // Only constraints that share an unknown cell with this one can add anything to it
+    int checked[Topology::MAX_NEIGHBOURS * Topology::MAX_NEIGHBOURS];
+    int checkedCount = 0;
+
+    for (std::uint8_t unknownSlots = mask; unknownSlots; unknownSlots &= unknownSlots - 1) {
+        for (int other: topology->getNeighbours(neighbours[std::countr_zero(unknownSlots)])) {
+            if (other == cell || states[other] != REVEALED || !masks[other]) continue;
+            if (std::find(checked, checked + checkedCount, other) != checked + checkedCount) continue;
+            checked[checkedCount++] = other;
+
+            if (checkPair(cell, neighbours, other)) {
+                enqueue(cell);
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * @function checkPair
+ * @brief Maps the masks of two overlapping constraints onto shared bits and compares them.
+ *
+ * Bits 0-7 stand for the neighbour slots of the first cell, bits 8-15 for the neighbour slots of
+ * the second cell that are not neighbours of the first.
+ *
+ * @param first The board index of the first revealed cell.
+ * @param firstNeighbours The neighbours of the first cell.
+ * @param second The board index of the second revealed cell.
+ * @return True if a deduction was made.
+ */
+bool Solver::checkPair(int first, const Topology::Neighbours &firstNeighbours, int second) {
+    Topology::Neighbours secondNeighbours = topology->getNeighbours(second);
+    std::uint16_t firstCells = masks[first];
+    std::uint16_t secondCells = 0;
+
+    for (std::uint8_t slots = masks[second]; slots; slots &= slots - 1) {
+        int slot = std::countr_zero(slots);
+        auto shared = std::find(firstNeighbours.begin(), firstNeighbours.end(), secondNeighbours[slot]);
+        if (shared != firstNeighbours.end()) {
+            secondCells |= 1 << (shared - firstNeighbours.begin());
+        } else {
+            secondCells |= 1 << (Topology::MAX_NEIGHBOURS + slot);
+        }
+    }
+
+    if (!(firstCells & secondCells)) {
+        return false;
+    }
+
+    return checkOrderedPair(firstCells, remaining[first], secondCells, remaining[second], firstNeighbours,
+                            secondNeighbours) ||
+           checkOrderedPair(secondCells, remaining[second], firstCells, remaining[first], firstNeighbours,
+                            secondNeighbours);
+}
+
+/**
+ * @function checkOrderedPair
+ * @brief Applies the subset and superset rules to two overlapping constraints.
+ *
+ * The cells only in the second constraint hold at least secondMines - firstMines mines. If that is
+ * all of them, they are mines and the cells only in the first constraint are safe. If the first
+ * constraint is a subset of the second one with the same count, the rest of the second is safe.
+ *
+ * @param first The unknown cells of the first constraint, as mapped by checkPair().
+ * @param firstMines The mines among them.
+ * @param second The unknown cells of the second constraint, as mapped by checkPair().
+ * @param secondMines The mines among them.
+ * @param firstNeighbours The neighbours of the cell whose neighbour slots bits 0-7 stand for.
+ * @param secondNeighbours The neighbours of the cell whose neighbour slots bits 8-15 stand for.
+ * @return True if a deduction was made.
+ */
+bool Solver::checkOrderedPair(std::uint16_t first, int firstMines, std::uint16_t second, int secondMines,
+                              const Topology::Neighbours &firstNeighbours,
+                              const Topology::Neighbours &secondNeighbours) {
+    std::uint16_t onlyFirst = first & ~second;
+    std::uint16_t onlySecond = second & ~first;
+    if (!onlySecond) {
+        return false;
+    }
+
+    if (secondMines - firstMines == std::popcount(onlySecond)) {
+        markCells(onlySecond, firstNeighbours, secondNeighbours, true);
+        markCells(onlyFirst, firstNeighbours, secondNeighbours, false);
+        return true;
+    }
+
+    if (!onlyFirst && secondMines == firstMines) {
+        markCells(onlySecond, firstNeighbours, secondNeighbours, false);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @function markCells
+ * @brief Marks every cell of a mapped mask as safe or as a mine.
+ *
+ * @param cells The cells to mark, bit i < 8 for neighbour slot i of the first cell and bit i >= 8
+ *              for neighbour slot i - 8 of the second cell.
+ * @param firstNeighbours The neighbours of the first cell.
+ * @param secondNeighbours The neighbours of the second cell.
+ * @param mine True to mark the cells as mines, false to mark them as safe.
+ */
+void Solver::markCells(std::uint16_t cells, const Topology::Neighbours &firstNeighbours,
+                       const Topology::Neighbours &secondNeighbours, bool mine) {
+    while (cells) {
+        int bit = std::countr_zero(cells);
+        cells &= cells - 1;
+
+        int cell = bit < Topology::MAX_NEIGHBOURS ? firstNeighbours[bit]
+                                                   : secondNeighbours[bit - Topology::MAX_NEIGHBOURS];
+        if (mine) {
+            markMine(cell);
+        } else {
+            markSafe(cell);
+        }
+    }
+}
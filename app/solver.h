@@ -0,0 +1,95 @@
+/**
+ * @file solver.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the Solver class, a deterministic logic engine that finds cells which are certainly
+ *        safe or certainly mines.
+ *
+ * Every revealed cell is a constraint: its unknown neighbours hold exactly its adjacent count minus
+ * the mines already found around it. The unknown neighbours are kept as a mask over the slots of
+ * the cell in the neighbour list of the board's Topology, and the constraints are updated in place
+ * through the reverse slots when cells are revealed or deduced, so a move only touches the
+ * constraints around the cells it changed. Changed constraints are queued and checked on their own
+ * (no mines left, or only mines left) and against every constraint that shares an unknown cell with
+ * them, for the subset and superset tests. The player's marks are not used, because a wrong flag
+ * would lead to wrong deductions. A new game on a board of the same size only clears the cells the
+ * previous game touched and reads the cells the player has touched, so it costs time in proportion
+ * to the moves played rather than to the size of the board. The solver only sees the board through
+ * a PlayerView.
+ */
+
+#ifndef QT_MINESWEEPER_SOLVER_H
+#define QT_MINESWEEPER_SOLVER_H
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+#include "playerview.h"
+#include "topology.h"
+
+class Solver {
+public:
+
+    explicit Solver(PlayerView view);
+
+    ~Solver();
+
+    void reset();
+
+    void update(std::span<const int> revealedCells);
+
+    bool isKnownSafe(int x, int y) const;
+
+    bool isKnownMine(int x, int y) const;
+
+    int findSafeCell();
+
+    const std::vector<int> &getKnownMines() const;
+
+private:
+
+    enum State : std::uint8_t {
+        UNKNOWN,
+        SAFE, // Deduced safe but not revealed yet
+        MINE,
+        REVEALED
+    };
+
+    void addRevealed(int cell);
+
+    void markSafe(int cell);
+
+    void markMine(int cell);
+
+    void removeFromConstraints(int cell, bool mine);
+
+    void enqueue(int cell);
+
+    void propagate();
+
+    void checkConstraint(int cell);
+
+    bool checkPair(int first, const Topology::Neighbours &firstNeighbours, int second);
+
+    bool checkOrderedPair(std::uint16_t first, int firstMines, std::uint16_t second, int secondMines,
+                          const Topology::Neighbours &firstNeighbours, const Topology::Neighbours &secondNeighbours);
+
+    void markCells(std::uint16_t cells, const Topology::Neighbours &firstNeighbours,
+                   const Topology::Neighbours &secondNeighbours, bool mine);
+
+    PlayerView view;
+    int width;
+    int height;
+    std::shared_ptr<const Topology> topology;
+    std::vector<std::uint8_t> masks; // Unknown neighbours of each revealed cell, bit i for neighbour slot i
+    std::vector<std::uint8_t> remaining; // Mines among the unknown neighbours of each revealed cell
+    std::vector<State> states;
+    std::vector<std::uint8_t> queued;
+    std::vector<int> dirty; // Constraints that changed since they were last checked
+    std::vector<int> safeCells; // Deduced safe cells, including some that have been revealed since
+    std::vector<int> knownMines;
+    std::vector<int> touchedCells; // Cells whose entries in the arrays above are not at their initial value
+};
+
+#endif //QT_MINESWEEPER_SOLVER_H
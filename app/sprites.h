@@ -0,0 +1,43 @@
+/**
+ * @file sprites.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the sprites that show the state of a cell and the image asset of each of them.
+ *
+ * The board view and the endless view draw the same cells, so they share the order of the sprites
+ * and the resource paths they are loaded from. The order is also the layout of the atlas of the
+ * board view.
+ */
+
+#ifndef QT_MINESWEEPER_SPRITES_H
+#define QT_MINESWEEPER_SPRITES_H
+
+enum Sprite {
+    SPRITE_ZERO, // SPRITE_ZERO + n is the sprite for n adjacent mines
+    SPRITE_HIDDEN = SPRITE_ZERO + 9,
+    SPRITE_FLAG,
+    SPRITE_QUESTION,
+    SPRITE_BOMB,
+    SPRITE_BOMB_EXPLODED,
+    SPRITE_COUNT
+};
+
+// Resource path of every sprite, indexed by Sprite
+constexpr const char *SPRITE_PATHS[SPRITE_COUNT] = {
+        ":/assets/zero_tile.png",
+        ":/assets/one_tile.png",
+        ":/assets/two_tile.png",
+        ":/assets/three_tile.png",
+        ":/assets/four_tile.png",
+        ":/assets/five_tile.png",
+        ":/assets/six_tile.png",
+        ":/assets/seven_tile.png",
+        ":/assets/eight_tile.png",
+        ":/assets/tile.png",
+        ":/assets/mine_flag.png",
+        ":/assets/question_mark.png",
+        ":/assets/bomb.png",
+        ":/assets/bomb_explode.png"
+};
+
+#endif //QT_MINESWEEPER_SPRITES_H
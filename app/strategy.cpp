@@ -0,0 +1,80 @@
+/**
+ * @file strategy.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the Strategy interface helpers: applying actions and creating the
+ *        built-in strategies by name.
+ */
+
+#include "builtinstrategies.h"
+#include "strategy.h"
+
+/**
+ * @function apply
+ * @brief Applies an action to a board, by the same rules as a move in the GUI.
+ *
+ * Actions on cells outside the board, and any action once the game is over, are ignored.
+ *
+ * @param board The board to play on.
+ * @param action The action to apply.
+ * @param changedCells Cleared, then filled with the indices of the cells the action changed.
+ * @return MINE if the action lost the game, SAFE if it revealed cells, IGNORED otherwise.
+ */
+Board::RevealResult Action::apply(Board &board, const Action &action, std::vector<int> &changedCells) {
+    changedCells.clear();
+
+    if (!board.contains(action.x, action.y) || board.isLost() || board.isWon()) {
+        return Board::RevealResult::IGNORED;
+    }
+
+    switch (action.type) {
+        case Type::REVEAL:
+            return board.reveal(action.x, action.y, &changedCells);
+        case Type::CHORD:
+            return board.chord(action.x, action.y, &changedCells);
+        case Type::FLAG:
+            if (!board.isRevealed(action.x, action.y)) {
+                bool flagged = board.getMark(action.x, action.y) == Board::Mark::FLAGGED;
+                board.setMark(action.x, action.y, flagged ? Board::Mark::NONE : Board::Mark::FLAGGED);
+                changedCells.push_back(action.y * board.getWidth() + action.x);
+            }
+            break;
+    }
+    return Board::RevealResult::IGNORED;
+}
+
+/**
+ * @function ~Strategy
+ * @brief Destructor for Strategy.
+ */
+Strategy::~Strategy() = default;
+
+/**
+ * @function create
+ * @brief Creates a built-in strategy by name.
+ *
+ * @param name The name of the strategy, one of getNames().
+ * @return The strategy, or nullptr if the name is unknown.
+ */
+std::unique_ptr<Strategy> Strategy::create(const std::string &name) {
+    if (name == "random") {
+        return std::make_unique<RandomStrategy>();
+    }
+    if (name == "solver") {
+        return std::make_unique<SolverStrategy>();
+    }
+    if (name == "probability") {
+        return std::make_unique<ProbabilityStrategy>();
+    }
+    return nullptr;
+}
+
+/**
+ * @function getNames
+ * @brief Returns the names of the built-in strategies.
+ *
+ * @return The names accepted by create().
+ */
+std::vector<std::string> Strategy::getNames() {
+    return {"random", "solver", "probability"};
+}
@@ -0,0 +1,56 @@
+/**
+ * @file strategy.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the Strategy interface that bots implement, and the actions they can take.
+ *
+ * A strategy gets a PlayerView of the board when a game starts and is then asked for one Action at
+ * a time, together with the cells the previous action changed, so it can keep its own state up to
+ * date incrementally. Actions are applied with the same Board calls the GUI uses (reveal, chord and
+ * flag), so a bot plays by exactly the rules a person does. Strategies are created by name, which
+ * lets the simulator and the tournament runner pick them from the command line.
+ */
+
+#ifndef QT_MINESWEEPER_STRATEGY_H
+#define QT_MINESWEEPER_STRATEGY_H
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+#include "board.h"
+#include "playerview.h"
+
+struct Action {
+
+    enum class Type {
+        REVEAL, // Reveal a hidden cell
+        FLAG, // Toggle the flag on a hidden cell
+        CHORD // Reveal the unflagged neighbours of a revealed number whose mines are all flagged
+    };
+
+    Type type;
+    int x;
+    int y;
+
+    static Board::RevealResult apply(Board &board, const Action &action, std::vector<int> &changedCells);
+};
+
+class Strategy {
+public:
+
+    virtual ~Strategy();
+
+    virtual const char *getName() const = 0;
+
+    virtual void newGame(PlayerView view, std::uint64_t seed) = 0;
+
+    virtual Action nextAction(std::span<const int> changedCells) = 0;
+
+    static std::unique_ptr<Strategy> create(const std::string &name);
+
+    static std::vector<std::string> getNames();
+};
+
+#endif //QT_MINESWEEPER_STRATEGY_H
@@ -0,0 +1,156 @@
+/**
+ * @file threadpool.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the ThreadPool class.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include "threadpool.h"
+
+/**
+ * @function ThreadPool
+ * @brief Starts the worker threads.
+ *
+ * @param threadCount The total number of threads that run a parallel loop, including the calling
+ *                    thread. A pool of one thread starts no workers at all.
+ */
+ThreadPool::ThreadPool(int threadCount) : stopping(false) {
+    for (int i = 1; i < threadCount; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+/**
+ * @function ~ThreadPool
+ * @brief Stops and joins the worker threads.
+ *
+ * Jobs that are still queued are run before the workers exit.
+ */
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    jobAvailable.notify_all();
+
+    for (std::thread &worker: workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @function global
+ * @brief Returns the process-wide pool sized to the machine.
+ *
+ * @return The shared ThreadPool.
+ */
+ThreadPool &ThreadPool::global() {
+    static ThreadPool pool;
+    return pool;
+}
+
+/**
+ * @function defaultThreadCount
+ * @brief Returns the number of hardware threads, or one if it cannot be determined.
+ *
+ * @return The default number of threads of a pool.
+ */
+int ThreadPool::defaultThreadCount() {
+    unsigned int count = std::thread::hardware_concurrency();
+    return count > 0 ? static_cast<int>(count) : 1;
+}
+
+/**
+ * @function getThreadCount
+ * @brief Returns the number of threads that run a parallel loop, including the caller.
+ *
+ * @return The thread count of the pool.
+ */
+int ThreadPool::getThreadCount() const {
+    return static_cast<int>(workers.size()) + 1;
+}
+
+/**
+ * @function parallelFor
+ * @brief Runs task(i) for every i in [0, count) and waits for all of them to finish.
+ *
+ * Indices are handed out one at a time from an atomic counter, so uneven tasks balance themselves.
+ * The order in which indices run is unspecified; callers that need deterministic results must make
+ * each task depend only on its index.
+ *
+ * @param count The number of tasks.
+ * @param task The task to run for each index. It must be safe to call concurrently.
+ */
+void ThreadPool::parallelFor(int count, const std::function<void(int)> &task) {
+    if (count <= 0) {
+        return;
+    }
+
+    if (count == 1 || workers.empty()) {
+        for (int i = 0; i < count; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    struct Loop {
+        std::atomic<int> next{0};
+        std::atomic<int> completed{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+    auto loop = std::make_shared<Loop>();
+    const std::function<void(int)> *body = &task;
+
+    // Helpers that start after the loop is done never touch the task, only the shared state
+    auto run = [loop, body, count]() {
+        int i;
+        while ((i = loop->next.fetch_add(1)) < count) {
+            (*body)(i);
+            if (loop->completed.fetch_add(1) + 1 == count) {
+                std::lock_guard<std::mutex> lock(loop->mutex);
+                loop->finished.notify_all();
+            }
+        }
+    };
+
+    int helpers = std::min(static_cast<int>(workers.size()), count - 1);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (int i = 0; i < helpers; i++) {
+            jobs.emplace_back(run);
+        }
+    }
+    jobAvailable.notify_all();
+
+    run();
+
+    std::unique_lock<std::mutex> lock(loop->mutex);
+    loop->finished.wait(lock, [&loop, count] { return loop->completed.load() == count; });
+}
+
+/**
+ * @function workerLoop
+ * @brief Runs queued jobs until the pool is stopped.
+ */
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobAvailable.wait(lock, [this] { return stopping || !jobs.empty(); });
+
+            if (jobs.empty()) {
+                return;
+            }
+
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        job();
+    }
+}
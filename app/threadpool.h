@@ -0,0 +1,56 @@
+/**
+ * @file threadpool.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the ThreadPool class, a fixed set of worker threads for data-parallel loops.
+ *
+ * parallelFor() splits an index range into tasks that the workers and the calling thread take
+ * from a shared counter until the range is exhausted. The caller always takes part, so a pool
+ * without workers (or a nested call from inside a worker) simply runs the loop inline.
+ */
+
+#ifndef QT_MINESWEEPER_THREADPOOL_H
+#define QT_MINESWEEPER_THREADPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+
+    explicit ThreadPool(int threadCount = defaultThreadCount());
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ThreadPool(ThreadPool &&) = delete;
+
+    ThreadPool &operator=(ThreadPool &&) = delete;
+
+    static ThreadPool &global();
+
+    static int defaultThreadCount();
+
+    int getThreadCount() const;
+
+    void parallelFor(int count, const std::function<void(int)> &task);
+
+private:
+
+    void workerLoop();
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> jobs;
+    std::mutex mutex;
+    std::condition_variable jobAvailable;
+    bool stopping;
+};
+
+#endif //QT_MINESWEEPER_THREADPOOL_H
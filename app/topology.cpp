@@ -0,0 +1,193 @@
+/**
+ * @file topology.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the Topology class, which builds and shares the neighbour tables of
+ *        the board shapes.
+ */
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include "topology.h"
+
+/**
+ * @function get
+ * @brief Returns the neighbour table of a board shape, building it if nobody uses it yet.
+ *
+ * The table asked for last is kept even when nothing uses it any more, so a solver that is made
+ * for every game of a simulation does not build the same table again each time. Safe to call from
+ * any thread.
+ *
+ * @param kind The topology.
+ * @param width The number of cells in a row.
+ * @param height The number of cells in a column.
+ * @return The shared table.
+ */
+std::shared_ptr<const Topology> Topology::get(Kind kind, int width, int height) {
+    static std::mutex mutex;
+    static std::map<std::tuple<Kind, int, int>, std::weak_ptr<const Topology>> tables;
+    static std::shared_ptr<const Topology> last;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::weak_ptr<const Topology> &entry = tables[{kind, width, height}];
+    std::shared_ptr<const Topology> table = entry.lock();
+
+    if (!table) {
+        table = std::shared_ptr<const Topology>(new Topology(kind, width, height));
+        entry = table;
+    }
+    last = table;
+    return table;
+}
+
+/**
+ * @function getName
+ * @brief Returns the name of a topology.
+ *
+ * @param kind The topology.
+ * @return "rectangle", "torus" or "hex".
+ */
+const char *Topology::getName(Kind kind) {
+    switch (kind) {
+        case Kind::TORUS:
+            return "torus";
+        case Kind::HEX:
+            return "hex";
+        default:
+            return "rectangle";
+    }
+}
+
+/**
+ * @function parse
+ * @brief Parses the name of a topology.
+ *
+ * @param name The name, as returned by getName().
+ * @param kind Set to the topology if the name is known.
+ * @return True if the name is known.
+ */
+bool Topology::parse(const std::string &name, Kind &kind) {
+    for (Kind candidate: {Kind::RECTANGLE, Kind::TORUS, Kind::HEX}) {
+        if (name == getName(candidate)) {
+            kind = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @function Topology
+ * @brief Builds the neighbour table of a board shape.
+ *
+ * @param kind The topology.
+ * @param width The number of cells in a row.
+ * @param height The number of cells in a column.
+ */
+Topology::Topology(Kind kind, int width, int height) : kind(kind), width(width), height(height) {
+    if (kind == Kind::RECTANGLE) {
+        return;
+    }
+
+    auto cellCount = static_cast<std::size_t>(width) * height;
+    rowStarts.reserve(cellCount + 1);
+    neighbours.reserve(cellCount * (kind == Kind::HEX ? 6 : MAX_NEIGHBOURS));
+
+    rowStarts.push_back(0);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            addNeighbours(x, y);
+            rowStarts.push_back(static_cast<int>(neighbours.size()));
+        }
+    }
+
+    // Every topology is symmetric, so the cell is in the row of each of its neighbours
+    reverseSlots.resize(neighbours.size());
+    for (int cell = 0; cell < static_cast<int>(cellCount); cell++) {
+        for (int i = rowStarts[cell]; i < rowStarts[cell + 1]; i++) {
+            auto row = neighbours.begin() + rowStarts[neighbours[i]];
+            auto rowEnd = neighbours.begin() + rowStarts[neighbours[i] + 1];
+            reverseSlots[i] = static_cast<std::uint8_t>(std::find(row, rowEnd, cell) - row);
+        }
+    }
+}
+
+/**
+ * @function getKind
+ * @brief Returns the topology of the table.
+ *
+ * @return The topology.
+ */
+Topology::Kind Topology::getKind() const {
+    return kind;
+}
+
+/**
+ * @function getWidth
+ * @brief Returns the number of cells in a row.
+ *
+ * @return The width of the board shape.
+ */
+int Topology::getWidth() const {
+    return width;
+}
+
+/**
+ * @function getHeight
+ * @brief Returns the number of cells in a column.
+ *
+ * @return The height of the board shape.
+ */
+int Topology::getHeight() const {
+    return height;
+}
+
+/**
+ * @function addNeighbours
+ * @brief Appends the neighbours of a cell to the table, in row-major order.
+ *
+ * On a torus narrower or lower than three cells, wrapping reaches the same cell from two sides, or
+ * the cell itself; each neighbour is listed once and the cell never.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ */
+void Topology::addNeighbours(int x, int y) {
+    auto first = neighbours.size();
+    int self = y * width + x;
+
+    auto add = [&](int nx, int ny) {
+        if (kind == Kind::TORUS) {
+            nx = (nx + width) % width;
+            ny = (ny + height) % height;
+        } else if (nx < 0 || nx >= width || ny < 0 || ny >= height) {
+            return;
+        }
+
+        int cell = ny * width + nx;
+        if (cell != self && std::find(neighbours.begin() + static_cast<std::ptrdiff_t>(first), neighbours.end(),
+                                      cell) == neighbours.end()) {
+            neighbours.push_back(cell);
+        }
+    };
+
+    if (kind == Kind::HEX) {
+        // Odd rows are shifted right, so the rows above and below reach one cell further right
+        int shift = y % 2;
+        add(x - 1 + shift, y - 1);
+        add(x + shift, y - 1);
+        add(x - 1, y);
+        add(x + 1, y);
+        add(x - 1 + shift, y + 1);
+        add(x + shift, y + 1);
+        return;
+    }
+
+    for (int ny = y - 1; ny <= y + 1; ny++) {
+        for (int nx = x - 1; nx <= x + 1; nx++) {
+            add(nx, ny);
+        }
+    }
+}
@@ -0,0 +1,160 @@
+/**
+ * @file topology.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the Topology class, the precomputed neighbour table of one board shape.
+ *
+ * A topology decides which cells are neighbours. RECTANGLE is the classic grid, TORUS wraps the
+ * edges around so every cell has eight neighbours, and HEX is a grid of hexagons in rows, every odd
+ * row shifted half a cell to the right, where a cell has up to six neighbours. getNeighbours(i)
+ * returns the neighbours of cell i in row-major order, and the reverse slot of each of them says
+ * where cell i appears in the list of that neighbour, so code that keeps per-neighbour bits can
+ * update both sides without searching.
+ *
+ * The neighbours of a rectangle cell are computed from its coordinates (see gridgeometry.h), so a
+ * rectangle costs nothing per cell. Torus and hex boards list the neighbours of every cell once in
+ * compressed sparse row form. Tables are shared: get() returns the same table for the same shape
+ * while anything still uses it.
+ */
+
+#ifndef QT_MINESWEEPER_TOPOLOGY_H
+#define QT_MINESWEEPER_TOPOLOGY_H
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "gridgeometry.h"
+
+class Topology {
+public:
+
+    enum class Kind : std::uint8_t {
+        RECTANGLE,
+        TORUS,
+        HEX
+    };
+
+    static constexpr int MAX_NEIGHBOURS = 8;
+
+    // The neighbours of one cell, iterable like a container of board indices
+    struct Neighbours {
+        const int *row = nullptr; // Into the table, or null if the neighbours are in cells
+        const std::uint8_t *reverseRow = nullptr; // Into the table of reverse slots
+        std::array<int, MAX_NEIGHBOURS> cells;
+        std::array<std::uint8_t, MAX_NEIGHBOURS> offsets; // Index of the offset of each neighbour of a rectangle cell
+        int count = 0;
+        int x = 0; // Coordinates of the cell on a rectangle
+        int y = 0;
+
+        const int *begin() const {
+            return row ? row : cells.data();
+        }
+
+        const int *end() const {
+            return begin() + count;
+        }
+
+        std::size_t size() const {
+            return static_cast<std::size_t>(count);
+        }
+
+        int operator[](std::size_t slot) const {
+            return begin()[slot];
+        }
+    };
+
+    static std::shared_ptr<const Topology> get(Kind kind, int width, int height);
+
+    static const char *getName(Kind kind);
+
+    static bool parse(const std::string &name, Kind &kind);
+
+    Kind getKind() const;
+
+    int getWidth() const;
+
+    int getHeight() const;
+
+    Neighbours getNeighbours(int cell) const {
+        Neighbours result;
+        if (kind == Kind::RECTANGLE) {
+            std::array<int, MAX_NEIGHBOURS> offsets = RuntimeGeometry({width, height}).getNeighbourOffsets();
+            result.y = cell / width;
+            result.x = cell - result.y * width;
+            std::uint8_t mask = getRectangleMask(result.x, result.y);
+            if (mask == 0xFF) {
+                for (int offset = 0; offset < MAX_NEIGHBOURS; offset++) {
+                    result.cells[offset] = cell + offsets[offset];
+                    result.offsets[offset] = static_cast<std::uint8_t>(offset);
+                }
+                result.count = MAX_NEIGHBOURS;
+                return result;
+            }
+            for (; mask; mask &= mask - 1) {
+                int offset = std::countr_zero(mask);
+                result.cells[result.count] = cell + offsets[offset];
+                result.offsets[result.count] = static_cast<std::uint8_t>(offset);
+                result.count++;
+            }
+        } else {
+            result.row = neighbours.data() + rowStarts[cell];
+            result.reverseRow = reverseSlots.data() + rowStarts[cell];
+            result.count = rowStarts[cell + 1] - rowStarts[cell];
+        }
+        return result;
+    }
+
+    // Position of the cell whose neighbours these are in the list of the neighbour in the given slot
+    int getReverseSlot(const Neighbours &neighbours, std::size_t slot) const {
+        if (neighbours.reverseRow) {
+            return neighbours.reverseRow[slot];
+        }
+
+        // The offsets are in row-major order, so the offset back to the cell is the mirrored one
+        int offset = neighbours.offsets[slot];
+        int position = offset + (offset >= MAX_NEIGHBOURS / 2); // In the 3x3 block, skipping the cell itself
+        std::uint8_t mask = getRectangleMask(neighbours.x + position % 3 - 1, neighbours.y + position / 3 - 1);
+        int back = MAX_NEIGHBOURS - 1 - offset;
+        return std::popcount(static_cast<unsigned>(mask & ((1u << back) - 1)));
+    }
+
+    template<typename Visit>
+    void forEachNeighbour(int cell, Visit visit) const {
+        if (kind == Kind::RECTANGLE) {
+            RuntimeGeometry({width, height}).forEachNeighbour(cell, visit);
+            return;
+        }
+        for (int i = rowStarts[cell]; i < rowStarts[cell + 1]; i++) {
+            visit(neighbours[i]);
+        }
+    }
+
+private:
+
+    Topology(Kind kind, int width, int height);
+
+    void addNeighbours(int x, int y);
+
+    // Bit i is set if the neighbour at RuntimeGeometry offset i is on the board
+    std::uint8_t getRectangleMask(int x, int y) const {
+        unsigned left = x > 0;
+        unsigned right = x < width - 1;
+        unsigned up = y > 0;
+        unsigned down = y < height - 1;
+        return static_cast<std::uint8_t>((up & left) | up << 1 | (up & right) << 2 | left << 3 | right << 4 |
+                                         (down & left) << 5 | down << 6 | (down & right) << 7);
+    }
+
+    Kind kind;
+    int width;
+    int height;
+    // Empty for rectangles. The neighbours of cell i are entries rowStarts[i] to rowStarts[i + 1] - 1
+    std::vector<int> rowStarts;
+    std::vector<int> neighbours;
+    std::vector<std::uint8_t> reverseSlots; // Position of the cell in the row of each of its neighbours
+};
+
+#endif //QT_MINESWEEPER_TOPOLOGY_H
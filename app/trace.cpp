@@ -0,0 +1,180 @@
+/**
+ * @file trace.cpp
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Implementation of the Trace class, which keeps a ring buffer of timed scopes per thread
+ *        and writes them as a Chrome trace.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "trace.h"
+
+namespace {
+
+// Fields are atomic so the exporter can read a buffer while its thread writes to it
+struct Event {
+    std::atomic<const char *> name;
+    std::atomic<std::int64_t> start;
+    std::atomic<std::int64_t> end;
+};
+
+struct Buffer {
+    int threadId;
+    std::atomic<std::uint64_t> head{0}; // Number of events ever recorded; event i is in slot i % BUFFER_EVENTS
+    std::unique_ptr<Event[]> events;
+};
+
+struct Registry {
+    std::mutex mutex; // Guards the list of buffers, never the buffers themselves
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    std::string exitPath;
+};
+
+// Never destroyed, so threads that are still running during exit can keep recording
+Registry &getRegistry() {
+    static auto *registry = new Registry;
+    return *registry;
+}
+
+Buffer &getThreadBuffer() {
+    thread_local Buffer *buffer = nullptr;
+
+    if (!buffer) {
+        Registry &registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto owned = std::make_unique<Buffer>();
+        owned->threadId = static_cast<int>(registry.buffers.size()) + 1;
+        owned->events = std::make_unique<Event[]>(Trace::BUFFER_EVENTS);
+        buffer = owned.get();
+        registry.buffers.push_back(std::move(owned));
+    }
+    return *buffer;
+}
+
+void writeEscaped(std::FILE *file, const char *text) {
+    for (; *text; text++) {
+        if (*text == '"' || *text == '\\') {
+            std::fputc('\\', file);
+        }
+        std::fputc(*text, file);
+    }
+}
+
+}
+
+/**
+ * @function record
+ * @brief Records a timed scope in the ring buffer of the calling thread.
+ *
+ * Only the calling thread writes to its buffer, so no lock is taken. The event is published by the
+ * final store to the buffer head. The slot may still be copied by write(), so a release fence
+ * orders the previous store to the head before the stores to the slot: a reader that sees any of
+ * them also sees that the head has moved past the old event.
+ *
+ * @param name The name of the scope. It must outlive the trace, e.g. a string literal.
+ * @param start The time the scope started, from now().
+ * @param end The time the scope ended, from now().
+ */
+void Trace::record(const char *name, std::int64_t start, std::int64_t end) {
+    Buffer &buffer = getThreadBuffer();
+    std::uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    Event &event = buffer.events[head % BUFFER_EVENTS];
+
+    std::atomic_thread_fence(std::memory_order_release);
+    event.name.store(name, std::memory_order_relaxed);
+    event.start.store(start, std::memory_order_relaxed);
+    event.end.store(end, std::memory_order_relaxed);
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+/**
+ * @function write
+ * @brief Writes the recorded events of all threads to a file in the Chrome trace-event format.
+ *
+ * Threads may keep recording while the trace is written. Events they overwrite during the export
+ * are left out rather than written half-updated.
+ *
+ * @param path The file to write.
+ * @return True if the file was written, false if it could not be opened.
+ */
+bool Trace::write(const std::string &path) {
+    std::FILE *file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    struct Copy {
+        const char *name;
+        std::int64_t start;
+        std::int64_t end;
+    };
+    std::vector<Copy> copies;
+    bool first = true;
+
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+    for (const std::unique_ptr<Buffer> &buffer: registry.buffers) {
+        std::uint64_t end = buffer->head.load(std::memory_order_acquire);
+        std::uint64_t begin = end > BUFFER_EVENTS ? end - BUFFER_EVENTS : 0;
+
+        copies.clear();
+        for (std::uint64_t i = begin; i < end; i++) {
+            const Event &event = buffer->events[i % BUFFER_EVENTS];
+            copies.push_back({event.name.load(std::memory_order_relaxed),
+                              event.start.load(std::memory_order_relaxed),
+                              event.end.load(std::memory_order_relaxed)});
+        }
+
+        // The slot of the event being written now, and all slots before it, may have been overwritten.
+        // The fence pairs with the one in record(), so a copy that read a newer event sees its head.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        std::uint64_t after = buffer->head.load(std::memory_order_relaxed);
+        std::uint64_t valid = after + 1 > BUFFER_EVENTS ? after + 1 - BUFFER_EVENTS : 0;
+
+        for (std::uint64_t i = std::max(begin, valid); i < end; i++) {
+            const Copy &copy = copies[i - begin];
+            std::fputs(first ? "\n" : ",\n", file);
+            first = false;
+            std::fputs("{\"name\":\"", file);
+            writeEscaped(file, copy.name);
+            std::fprintf(file, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", buffer->threadId,
+                         static_cast<double>(copy.start) / 1e3, static_cast<double>(copy.end - copy.start) / 1e3);
+        }
+    }
+    std::fputs("\n]}\n", file);
+
+    return std::fclose(file) == 0;
+}
+
+/**
+ * @function writeAtExit
+ * @brief Makes the program write the trace when it exits normally.
+ *
+ * Calling it again only changes the file.
+ *
+ * @param path The file to write.
+ */
+void Trace::writeAtExit(const std::string &path) {
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    if (registry.exitPath.empty()) {
+        std::atexit([] {
+            std::string exitPath;
+            {
+                std::lock_guard<std::mutex> lock(getRegistry().mutex);
+                exitPath = getRegistry().exitPath;
+            }
+            write(exitPath);
+        });
+    }
+    registry.exitPath = path;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file trace.h
+ * @author Ryan Hecht
+ * @date 2026-10-18
+ * @brief Defines the Trace class and the TRACE_SCOPE macro, which time the hot paths of the game
+ *        and export them as a Chrome trace.
+ *
+ * TRACE_SCOPE("name") records how long the enclosing scope took. Every thread writes its events
+ * into its own fixed-size ring buffer without taking a lock, so recording costs two clock reads and
+ * a few stores; once a buffer is full, the oldest events are overwritten. write() exports the
+ * events of all threads in the Chrome trace-event format, which chrome://tracing and Perfetto
+ * open. Tracing is only compiled in when MINESWEEPER_TRACING is defined (the CMake option of the
+ * same name); otherwise TRACE_SCOPE expands to nothing and costs nothing.
+ */
+
+#ifndef QT_MINESWEEPER_TRACE_H
+#define QT_MINESWEEPER_TRACE_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+class Trace {
+public:
+
+    static constexpr int BUFFER_EVENTS = 1 << 16; // Events kept per thread
+
+    class Scope {
+    public:
+
+        explicit Scope(const char *name) : name(name), start(now()) {}
+
+        ~Scope() {
+            record(name, start, now());
+        }
+
+        Scope(const Scope &) = delete;
+
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+
+        const char *name;
+        std::int64_t start;
+    };
+
+    static std::int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static void record(const char *name, std::int64_t start, std::int64_t end);
+
+    static bool write(const std::string &path);
+
+    static void writeAtExit(const std::string &path);
+};
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+
+#ifdef MINESWEEPER_TRACING
+#define TRACE_SCOPE(name) Trace::Scope TRACE_CONCAT(traceScope, __LINE__)(name)
+#else
+#define TRACE_SCOPE(name) static_cast<void>(0)
+#endif
+
+#endif //QT_MINESWEEPER_TRACE_H